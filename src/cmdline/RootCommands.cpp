@@ -21,6 +21,7 @@ extern "C"
     #include "../config.h"
     #include "../openrct2.h"
     #include "../platform/crash.h"
+    #include "../replay.h"
 }
 
 #include "../core/Console.hpp"
@@ -84,6 +85,7 @@ static exitcode_t HandleCommandIntro(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandHost(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandJoin(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandSetRCT2(CommandLineArgEnumerator * enumerator);
+static exitcode_t HandleCommandReplay(CommandLineArgEnumerator * enumerator);
 
 #if defined(__WINDOWS__) && !defined(__MINGW32__)
 
@@ -114,6 +116,7 @@ const CommandLineCommand CommandLine::RootCommands[]
 #endif
     DefineCommand("set-rct2", "<path>",                 StandardOptions, HandleCommandSetRCT2),
     DefineCommand("convert",  "<source> <destination>", StandardOptions, CommandLine::HandleCommandConvert),
+    DefineCommand("replay",   "<recording>",            StandardOptions, HandleCommandReplay ),
 
 #if defined(__WINDOWS__) && !defined(__MINGW32__)
     DefineCommand("register-shell", "", RegisterShellOptions, HandleCommandRegisterShell),
@@ -135,6 +138,7 @@ const CommandLineExample CommandLine::RootExamples[]
 #ifndef DISABLE_NETWORK
     { "host ./my_park.sv6 --port 11753 --headless",   "run a headless server for a saved park" },
 #endif
+    { "replay ./session.rec",                         "play back a recorded session headless"  },
     ExampleTableEnd
 };
 
@@ -241,6 +245,28 @@ exitcode_t HandleCommandIntro(CommandLineArgEnumerator * enumerator)
     return EXITCODE_CONTINUE;
 }
 
+exitcode_t HandleCommandReplay(CommandLineArgEnumerator * enumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    const char * recordingPath;
+    if (!enumerator->TryPopString(&recordingPath))
+    {
+        Console::Error::WriteLine("Expected path to a recording.");
+        return EXITCODE_FAIL;
+    }
+
+    if (cmdline_for_replay(recordingPath) < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
 #ifndef DISABLE_NETWORK
 
 exitcode_t HandleCommandHost(CommandLineArgEnumerator * enumerator)
@@ -19,15 +19,18 @@ extern "C"
     #include "../interface/screenshot.h"
 }
 
+#include "../core/Console.hpp"
 #include "CommandLine.hpp"
 
 static exitcode_t HandleScreenshot(CommandLineArgEnumerator *argEnumerator);
+static exitcode_t HandleScreenshotBatch(CommandLineArgEnumerator *argEnumerator);
 
 const CommandLineCommand CommandLine::ScreenshotCommands[]
 {
     // Main commands
-    DefineCommand("", "<file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]", nullptr, HandleScreenshot),
-    DefineCommand("", "<file> <output_image> giant <zoom> <rotation>",                      nullptr, HandleScreenshot),
+    DefineCommand("",      "<file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]", nullptr, HandleScreenshot     ),
+    DefineCommand("",      "<file> <output_image> giant <zoom> <rotation>",                      nullptr, HandleScreenshot     ),
+    DefineCommand("batch", "<manifest>",                                                         nullptr, HandleScreenshotBatch),
     CommandTableEnd
 };
 
@@ -41,3 +44,19 @@ static exitcode_t HandleScreenshot(CommandLineArgEnumerator *argEnumerator)
     }
     return EXITCODE_OK;
 }
+
+static exitcode_t HandleScreenshotBatch(CommandLineArgEnumerator *argEnumerator)
+{
+    const char * manifestPath;
+    if (!argEnumerator->TryPopString(&manifestPath))
+    {
+        Console::Error::WriteLine("Expected a manifest path.");
+        return EXITCODE_FAIL;
+    }
+
+    int result = cmdline_for_screenshot_batch(manifestPath);
+    if (result < 0) {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
@@ -42,6 +42,10 @@ rct_sprite_file_header spriteFileHeader;
 rct_g1_element *spriteFileEntries;
 uint8 *spriteFileData;
 
+// Allocated sizes of spriteFileEntries and spriteFileData, which can be larger than the header says while appending
+static uint32 _spriteFileEntriesCapacity;
+static uint32 _spriteFileDataCapacity;
+
 void sprite_file_load_palette(int spriteIndex)
 {
 	rct_g1_element *g1 = &spriteFileEntries[spriteIndex];
@@ -98,12 +102,55 @@ bool sprite_file_open(const utf8 *path)
 		}
 
 		sprite_entries_make_absolute();
+	} else {
+		spriteFileEntries = NULL;
+		spriteFileData = NULL;
 	}
+	_spriteFileEntriesCapacity = spriteFileHeader.num_entries;
+	_spriteFileDataCapacity = spriteFileHeader.total_size;
 
 	SDL_RWclose(file);
 	return true;
 }
 
+/**
+ * Starts a new sprite file in memory with no entries.
+ */
+void sprite_file_create()
+{
+	spriteFileHeader.num_entries = 0;
+	spriteFileHeader.total_size = 0;
+	spriteFileEntries = NULL;
+	spriteFileData = NULL;
+	_spriteFileEntriesCapacity = 0;
+	_spriteFileDataCapacity = 0;
+}
+
+/**
+ * Adds an imported image to the end of the sprite file in memory. The entry table and data grow geometrically so
+ * appending many images only copies the existing data a logarithmic number of times.
+ */
+void sprite_file_append(const rct_g1_element *element, const uint8 *buffer, int bufferLength)
+{
+	if (spriteFileHeader.num_entries + 1 > _spriteFileEntriesCapacity) {
+		_spriteFileEntriesCapacity = max(64, _spriteFileEntriesCapacity * 2);
+		spriteFileEntries = realloc(spriteFileEntries, _spriteFileEntriesCapacity * sizeof(rct_g1_element));
+	}
+	if (spriteFileHeader.total_size + bufferLength > _spriteFileDataCapacity) {
+		_spriteFileDataCapacity = max(spriteFileHeader.total_size + bufferLength, _spriteFileDataCapacity * 2);
+		sprite_entries_make_relative();
+		spriteFileData = realloc(spriteFileData, _spriteFileDataCapacity);
+		sprite_entries_make_absolute();
+	}
+
+	uint8 *dst = spriteFileData + spriteFileHeader.total_size;
+	memcpy(dst, buffer, bufferLength);
+	spriteFileEntries[spriteFileHeader.num_entries] = *element;
+	spriteFileEntries[spriteFileHeader.num_entries].offset = dst;
+	spriteFileHeader.num_entries++;
+	spriteFileHeader.total_size += bufferLength;
+}
+
 bool sprite_file_save(const char *path)
 {
 	SDL_RWops *file = SDL_RWFromFile(path, "wb");
@@ -140,8 +187,10 @@ bool sprite_file_save(const char *path)
 
 void sprite_file_close()
 {
-	free(spriteFileEntries);
-	free(spriteFileData);
+	SafeFree(spriteFileEntries);
+	SafeFree(spriteFileData);
+	_spriteFileEntriesCapacity = 0;
+	_spriteFileDataCapacity = 0;
 }
 
 bool sprite_file_export(int spriteIndex, const char *outPath)
@@ -231,6 +280,160 @@ int get_palette_index(sint16 *colour)
 	return -1;
 }
 
+/**
+ * Lookups for matching colours against _standardPalette, which every import starts from. Exact matches come from a hash
+ * of the RGB value. For closest matches the RGB cube is split into cells, each listing only the palette entries that can
+ * be nearest to some colour in the cell, in palette order so ties resolve the same way as get_closest_palette_index.
+ */
+#define PALETTE_HASH_SIZE 512
+#define PALETTE_CELL_SHIFT 5
+#define PALETTE_CELLS_PER_AXIS (256 >> PALETTE_CELL_SHIFT)
+#define PALETTE_CELL_COUNT (PALETTE_CELLS_PER_AXIS * PALETTE_CELLS_PER_AXIS * PALETTE_CELLS_PER_AXIS)
+
+static bool _paletteLookupInitialised = false;
+static uint32 _paletteHashKeys[PALETTE_HASH_SIZE];
+static sint16 _paletteHashIndices[PALETTE_HASH_SIZE];
+static uint32 _paletteCellOffsets[PALETTE_CELL_COUNT + 1];
+static uint8 _paletteCellCandidates[PALETTE_CELL_COUNT * 256];
+
+static uint32 palette_hash(uint32 rgb)
+{
+	return (rgb * 2654435761U) >> (32 - 9);
+}
+
+static int palette_axis_min_distance(int value, int low, int high)
+{
+	if (value < low)
+		return low - value;
+	if (value > high)
+		return value - high;
+	return 0;
+}
+
+static int palette_axis_max_distance(int value, int low, int high)
+{
+	return max(abs(value - low), abs(value - high));
+}
+
+static void palette_lookup_initialise()
+{
+	if (_paletteLookupInitialised)
+		return;
+
+	for (int i = 0; i < PALETTE_HASH_SIZE; i++)
+		_paletteHashIndices[i] = -1;
+
+	// Earlier entries win so duplicate colours match the same index as a linear search
+	for (int i = 0; i < 256; i++) {
+		const rct_sprite_file_palette_entry *entry = &_standardPalette[i];
+		uint32 rgb = (entry->r << 16) | (entry->g << 8) | entry->b;
+		uint32 slot = palette_hash(rgb);
+		while (_paletteHashIndices[slot] != -1 && _paletteHashKeys[slot] != rgb)
+			slot = (slot + 1) % PALETTE_HASH_SIZE;
+
+		if (_paletteHashIndices[slot] == -1) {
+			_paletteHashKeys[slot] = rgb;
+			_paletteHashIndices[slot] = i;
+		}
+	}
+
+	uint32 numCandidates = 0;
+	for (int cell = 0; cell < PALETTE_CELL_COUNT; cell++) {
+		int rLow = (cell / (PALETTE_CELLS_PER_AXIS * PALETTE_CELLS_PER_AXIS)) << PALETTE_CELL_SHIFT;
+		int gLow = ((cell / PALETTE_CELLS_PER_AXIS) % PALETTE_CELLS_PER_AXIS) << PALETTE_CELL_SHIFT;
+		int bLow = (cell % PALETTE_CELLS_PER_AXIS) << PALETTE_CELL_SHIFT;
+		int cellSize = (1 << PALETTE_CELL_SHIFT) - 1;
+
+		// No colour in the cell is further than this from its nearest entry
+		int minMaxDistance = INT32_MAX;
+		for (int i = 0; i < 256; i++) {
+			if (!is_changable_pixel(i))
+				continue;
+
+			const rct_sprite_file_palette_entry *entry = &_standardPalette[i];
+			int dr = palette_axis_max_distance(entry->r, rLow, rLow + cellSize);
+			int dg = palette_axis_max_distance(entry->g, gLow, gLow + cellSize);
+			int db = palette_axis_max_distance(entry->b, bLow, bLow + cellSize);
+			minMaxDistance = min(minMaxDistance, dr * dr + dg * dg + db * db);
+		}
+
+		_paletteCellOffsets[cell] = numCandidates;
+		for (int i = 0; i < 256; i++) {
+			if (!is_changable_pixel(i))
+				continue;
+
+			const rct_sprite_file_palette_entry *entry = &_standardPalette[i];
+			int dr = palette_axis_min_distance(entry->r, rLow, rLow + cellSize);
+			int dg = palette_axis_min_distance(entry->g, gLow, gLow + cellSize);
+			int db = palette_axis_min_distance(entry->b, bLow, bLow + cellSize);
+			if (dr * dr + dg * dg + db * db <= minMaxDistance)
+				_paletteCellCandidates[numCandidates++] = (uint8)i;
+		}
+	}
+	_paletteCellOffsets[PALETTE_CELL_COUNT] = numCandidates;
+
+	_paletteLookupInitialised = true;
+}
+
+static bool is_colour_in_range(sint16 *colour)
+{
+	return
+		colour[0] >= 0 && colour[0] <= 255 &&
+		colour[1] >= 0 && colour[1] <= 255 &&
+		colour[2] >= 0 && colour[2] <= 255;
+}
+
+/**
+ * Same as get_palette_index for the standard palette.
+ */
+static int sprite_import_get_palette_index(sint16 *colour)
+{
+	if (is_transparent_pixel(colour))
+		return -1;
+
+	// Dithering can push components outside the range any palette entry has
+	if (!is_colour_in_range(colour))
+		return -1;
+
+	uint32 rgb = (colour[0] << 16) | (colour[1] << 8) | colour[2];
+	uint32 slot = palette_hash(rgb);
+	while (_paletteHashIndices[slot] != -1) {
+		if (_paletteHashKeys[slot] == rgb)
+			return _paletteHashIndices[slot];
+		slot = (slot + 1) % PALETTE_HASH_SIZE;
+	}
+	return -1;
+}
+
+/**
+ * Same as get_closest_palette_index for the standard palette.
+ */
+static int sprite_import_get_closest_palette_index(sint16 *colour)
+{
+	if (!is_colour_in_range(colour))
+		return get_closest_palette_index(colour);
+
+	int cell =
+		((colour[0] >> PALETTE_CELL_SHIFT) * PALETTE_CELLS_PER_AXIS + (colour[1] >> PALETTE_CELL_SHIFT)) * PALETTE_CELLS_PER_AXIS +
+		(colour[2] >> PALETTE_CELL_SHIFT);
+
+	uint32 smallest_error = -1;
+	int best_match = -1;
+	for (uint32 i = _paletteCellOffsets[cell]; i < _paletteCellOffsets[cell + 1]; i++) {
+		int x = _paletteCellCandidates[i];
+		uint32 error =
+			((sint16)(_standardPalette[x].r) - colour[0]) * ((sint16)(_standardPalette[x].r) - colour[0]) +
+			((sint16)(_standardPalette[x].g) - colour[1]) * ((sint16)(_standardPalette[x].g) - colour[1]) +
+			((sint16)(_standardPalette[x].b) - colour[2]) * ((sint16)(_standardPalette[x].b) - colour[2]);
+
+		if (smallest_error == -1 || smallest_error > error){
+			best_match = x;
+			smallest_error = error;
+		}
+	}
+	return best_match;
+}
+
 typedef struct rle_code {
 	uint8 num_pixels;
 	uint8 offset_x;
@@ -252,6 +455,7 @@ bool sprite_file_import(const char *path, rct_g1_element *outElement, uint8 **ou
 	}
 
 	memcpy(spriteFilePalette, _standardPalette, 256 * 4);
+	palette_lookup_initialise();
 
 	uint8 *buffer = malloc((height * 2) + (width * height * 16));
 	memset(buffer, 0, (height * 2) + (width * height * 16));
@@ -278,21 +482,21 @@ bool sprite_file_import(const char *path, rct_g1_element *outElement, uint8 **ou
 		int pixels = 0;
 		bool pushRun = false;
 		for (unsigned int x = 0; x < width; x++) {
-			int paletteIndex = get_palette_index(src);
+			int paletteIndex = sprite_import_get_palette_index(src);
 
 			if (mode == MODE_CLOSEST || mode == MODE_DITHERING)
 				if (paletteIndex == -1 && !is_transparent_pixel(src))
-					paletteIndex = get_closest_palette_index(src);
+					paletteIndex = sprite_import_get_closest_palette_index(src);
 
 
 			if (mode == MODE_DITHERING)
-				if (!is_transparent_pixel(src) && is_changable_pixel(get_palette_index(src))){
+				if (!is_transparent_pixel(src) && is_changable_pixel(sprite_import_get_palette_index(src))){
 					sint16 dr = src[0] - (sint16)(spriteFilePalette[paletteIndex].r);
 					sint16 dg = src[1] - (sint16)(spriteFilePalette[paletteIndex].g);
 					sint16 db = src[2] - (sint16)(spriteFilePalette[paletteIndex].b);
 
 					if (x + 1 < width){
-						if (!is_transparent_pixel(src + 4) && is_changable_pixel(get_palette_index(src + 4))){
+						if (!is_transparent_pixel(src + 4) && is_changable_pixel(sprite_import_get_palette_index(src + 4))){
 							// Right
 							src[4] += dr * 7 / 16;
 							src[5] += dg * 7 / 16;
@@ -302,7 +506,7 @@ bool sprite_file_import(const char *path, rct_g1_element *outElement, uint8 **ou
 
 					if (y + 1 < height){
 						if (x > 0){
-							if (!is_transparent_pixel(src + 4 * (width - 1)) && is_changable_pixel(get_palette_index(src + 4 * (width - 1)))){
+							if (!is_transparent_pixel(src + 4 * (width - 1)) && is_changable_pixel(sprite_import_get_palette_index(src + 4 * (width - 1)))){
 								// Bottom left
 								src[4 * (width - 1)] += dr * 3 / 16;
 								src[4 * (width - 1) + 1] += dg * 3 / 16;
@@ -311,14 +515,14 @@ bool sprite_file_import(const char *path, rct_g1_element *outElement, uint8 **ou
 						}
 
 						// Bottom
-						if (!is_transparent_pixel(src + 4 * width) && is_changable_pixel(get_palette_index(src + 4 * width))){
+						if (!is_transparent_pixel(src + 4 * width) && is_changable_pixel(sprite_import_get_palette_index(src + 4 * width))){
 							src[4 * width] += dr * 5 / 16;
 							src[4 * width + 1] += dg * 5 / 16;
 							src[4 * width + 2] += db * 5 / 16;
 						}
 
 						if (x + 1 < width){
-							if (!is_transparent_pixel(src + 4 * (width - 1)) && is_changable_pixel(get_palette_index(src + 4 * (width + 1)))){
+							if (!is_transparent_pixel(src + 4 * (width - 1)) && is_changable_pixel(sprite_import_get_palette_index(src + 4 * (width + 1)))){
 								// Bottom right
 								src[4 * (width + 1)] += dr * 1 / 16;
 								src[4 * (width + 1) + 1] += dg * 1 / 16;
@@ -535,46 +739,43 @@ int cmdline_for_sprite(const char **argv, int argc)
 
 		const char *spriteFilePath = argv[1];
 
-		spriteFileHeader.num_entries = 0;
-		spriteFileHeader.total_size = 0;
+		sprite_file_create();
 		sprite_file_save(spriteFilePath);
 
 		sprite_file_close();
 		return 1;
 	} else if (_strcmpi(argv[0], "append") == 0) {
 		if (argc < 3) {
-			fprintf(stderr, "usage: sprite append <spritefile> <input>\n");
+			fprintf(stderr, "usage: sprite append <spritefile> <input> [input...]\n");
 			return -1;
 		}
 
 		const char *spriteFilePath = argv[1];
-		const char *imagePath = argv[2];
-
-		rct_g1_element spriteElement;
-		uint8 *buffer;
-		int bufferLength;
-		if (!sprite_file_import(imagePath, &spriteElement, &buffer, &bufferLength, gSpriteMode))
-			return -1;
 
 		if (!sprite_file_open(spriteFilePath)) {
 			fprintf(stderr, "Unable to open input sprite file.\n");
 			return -1;
 		}
 
-		spriteFileHeader.num_entries++;
-		spriteFileHeader.total_size += bufferLength;
-		spriteFileEntries = realloc(spriteFileEntries, spriteFileHeader.num_entries * sizeof(rct_g1_element));
+		// Import every image before writing so the sprite file is only saved once
+		for (int i = 2; i < argc; i++) {
+			const char *imagePath = argv[i];
 
-		sprite_entries_make_relative();
-		spriteFileData = realloc(spriteFileData, spriteFileHeader.total_size);
-		sprite_entries_make_absolute();
+			rct_g1_element spriteElement;
+			uint8 *buffer;
+			int bufferLength;
+			if (!sprite_file_import(imagePath, &spriteElement, &buffer, &bufferLength, gSpriteMode)) {
+				sprite_file_close();
+				return -1;
+			}
 
-		spriteFileEntries[spriteFileHeader.num_entries - 1] = spriteElement;
-		memcpy(spriteFileData + (spriteFileHeader.total_size - bufferLength), buffer, bufferLength);
-		spriteFileEntries[spriteFileHeader.num_entries - 1].offset = spriteFileData + (spriteFileHeader.total_size - bufferLength);
+			sprite_file_append(&spriteElement, buffer, bufferLength);
+			free(buffer);
+		}
 
-		free(buffer);
-		if (!sprite_file_save(spriteFilePath))
+		bool saved = sprite_file_save(spriteFilePath);
+		sprite_file_close();
+		if (!saved)
 			return -1;
 
 		return 1;
@@ -592,9 +793,8 @@ int cmdline_for_sprite(const char **argv, int argc)
 		bool silent = (argc >= 4 && strcmp(argv[3], "silent") == 0);
 		SDL_RWops *file;
 
-		spriteFileHeader.num_entries = 0;
-		spriteFileHeader.total_size = 0;
-		sprite_file_save(spriteFilePath);
+		// The whole sprite file is built in memory and written once all the images are imported
+		sprite_file_create();
 
 		fprintf(stdout, "Building: %s\n", spriteFilePath);
 		int i = 0;
@@ -613,38 +813,25 @@ int cmdline_for_sprite(const char **argv, int argc)
 				int bufferLength;
 				if (!sprite_file_import(imagePath, &spriteElement, &buffer, &bufferLength, gSpriteMode)) {
 					fprintf(stderr, "Could not import image file: %s\nCanceling\n", imagePath);
+					sprite_file_close();
 					return -1;
 				}
 
-				if (!sprite_file_open(spriteFilePath)) {
-					fprintf(stderr, "Unable to open sprite file: %s\nCanceling\n", spriteFilePath);
-					return -1;
-				}
-
-				spriteFileHeader.num_entries++;
-				spriteFileHeader.total_size += bufferLength;
-				spriteFileEntries = realloc(spriteFileEntries, spriteFileHeader.num_entries * sizeof(rct_g1_element));
-
-				sprite_entries_make_relative();
-				spriteFileData = realloc(spriteFileData, spriteFileHeader.total_size);
-				sprite_entries_make_absolute();
-
-				spriteFileEntries[spriteFileHeader.num_entries - 1] = spriteElement;
-				memcpy(spriteFileData + (spriteFileHeader.total_size - bufferLength), buffer, bufferLength);
-				spriteFileEntries[spriteFileHeader.num_entries - 1].offset = spriteFileData + (spriteFileHeader.total_size - bufferLength);
-
+				sprite_file_append(&spriteElement, buffer, bufferLength);
 				free(buffer);
 
-				if (!sprite_file_save(spriteFilePath)) {
-					fprintf(stderr, "Could not save sprite file: %s\nCanceling\n", imagePath);
-					return -1;
-				}
 				if (!silent)
 					fprintf(stdout, "Added: %s\n", imagePath);
 			}
 			i++;
 		} while (file != NULL);
 
+		bool saved = sprite_file_save(spriteFilePath);
+		sprite_file_close();
+		if (!saved) {
+			fprintf(stderr, "Could not save sprite file: %s\nCanceling\n", spriteFilePath);
+			return -1;
+		}
 
 		fprintf(stdout, "Finished\n");
 		return 1;
@@ -218,6 +218,32 @@ uint8* gfx_get_dirty_blocks()
 	return _screenDirtyBlocks;
 }
 
+/**
+ * Converts a screen rectangle into the inclusive range of dirty blocks it covers.
+ * @returns false if the rectangle is not on the screen.
+ */
+static bool gfx_get_dirty_block_range(sint16 *left, sint16 *top, sint16 *right, sint16 *bottom)
+{
+	*left = max(*left, 0);
+	*top = max(*top, 0);
+	*right = min(*right, gScreenWidth);
+	*bottom = min(*bottom, gScreenHeight);
+
+	if (*left >= *right)
+		return false;
+	if (*top >= *bottom)
+		return false;
+
+	(*right)--;
+	(*bottom)--;
+
+	*left >>= _screenDirtyBlockShiftX;
+	*right >>= _screenDirtyBlockShiftX;
+	*top >>= _screenDirtyBlockShiftY;
+	*bottom >>= _screenDirtyBlockShiftY;
+	return true;
+}
+
 /**
  *
  *  rct2: 0x006E732D
@@ -231,23 +257,8 @@ void gfx_set_dirty_blocks(sint16 left, sint16 top, sint16 right, sint16 bottom)
 	int x, y;
 	uint8 *screenDirtyBlocks = gfx_get_dirty_blocks();
 
-	left = max(left, 0);
-	top = max(top, 0);
-	right = min(right, gScreenWidth);
-	bottom = min(bottom, gScreenHeight);
-
-	if (left >= right)
+	if (!gfx_get_dirty_block_range(&left, &top, &right, &bottom))
 		return;
-	if (top >= bottom)
-		return;
-
-	right--;
-	bottom--;
-
-	left >>= _screenDirtyBlockShiftX;
-	right >>= _screenDirtyBlockShiftX;
-	top >>= _screenDirtyBlockShiftY;
-	bottom >>= _screenDirtyBlockShiftY;
 
 	uint32 dirtyBlockColumns = _screenDirtyBlockColumns;
 	for (y = top; y <= bottom; y++) {
@@ -258,6 +269,17 @@ void gfx_set_dirty_blocks(sint16 left, sint16 top, sint16 right, sint16 bottom)
 	}
 }
 
+/**
+ * Gets the number of dirty blocks gfx_set_dirty_blocks would mark for the given rectangle.
+ */
+uint32 gfx_get_dirty_block_count(sint16 left, sint16 top, sint16 right, sint16 bottom)
+{
+	if (!gfx_get_dirty_block_range(&left, &top, &right, &bottom))
+		return 0;
+
+	return (right - left + 1) * (bottom - top + 1);
+}
+
 /**
  *
  *  rct2: 0x006E73BE
@@ -349,7 +371,21 @@ void gfx_redraw_screen_rect(short left, short top, short right, short bottom)
 	windowDPI->height = bottom - top;
 	windowDPI->pitch = screenDPI->width + screenDPI->pitch + left - right;
 
-	for (w = g_window_list; w < gWindowNextSlot; w++) {
+	gWindowDrawStats.visible += (right - left) * (bottom - top);
+
+	// Windows below the topmost opaque window covering the whole rectangle can not be seen, start drawing from it
+	rct_window *firstVisible = g_window_list;
+	for (w = gWindowNextSlot - 1; w >= g_window_list; w--) {
+		if (w->flags & WF_TRANSPARENT)
+			continue;
+		if (left >= w->x && top >= w->y && right <= w->x + w->width && bottom <= w->y + w->height) {
+			gWindowDrawStats.skipped += (uint32)(w - g_window_list);
+			firstVisible = w;
+			break;
+		}
+	}
+
+	for (w = firstVisible; w < gWindowNextSlot; w++) {
 		if (w->flags & WF_TRANSPARENT)
 			continue;
 		if (right <= w->x || bottom <= w->y)
@@ -44,6 +44,7 @@ typedef struct rct_g1_element {
 
 enum {
 	G1_FLAG_BMP = (1 << 0), //No invisible sections
+	G1_FLAG_1 = (1 << 1), //Purpose unknown, the image data is copied to a temporary buffer before being drawn
 	G1_FLAG_RLE_COMPRESSION = (1<<2),
 };
 
@@ -105,6 +106,7 @@ extern rct_drawpixelinfo gWindowDPI;
 //
 bool clip_drawpixelinfo(rct_drawpixelinfo *dst, rct_drawpixelinfo *src, int x, int y, int width, int height);
 void gfx_set_dirty_blocks(sint16 left, sint16 top, sint16 right, sint16 bottom);
+uint32 gfx_get_dirty_block_count(sint16 left, sint16 top, sint16 right, sint16 bottom);
 void gfx_draw_all_dirty_blocks();
 void gfx_redraw_screen_rect(short left, short top, short right, short bottom);
 void gfx_invalidate_screen();
@@ -164,6 +166,14 @@ void gfx_draw_string_with_y_offsets(rct_drawpixelinfo *dpi, const utf8 *text, in
 int gfx_clip_string(char* buffer, int width);
 void shorten_path(utf8 *buffer, size_t bufferSize, const utf8 *path, int availableWidth);
 
+typedef struct ttf_glyph_cache_stats {
+	uint32 hits;
+	uint32 rasterised;
+	uint32 flushes;
+} ttf_glyph_cache_stats;
+
+extern ttf_glyph_cache_stats gTTFGlyphCacheStats;
+
 bool ttf_initialise();
 void ttf_dispose();
 
@@ -502,7 +502,7 @@ void FASTCALL gfx_draw_sprite_palette_set(rct_drawpixelinfo *dpi, int image_id,
 	//Move the pointer to the start point of the source
 	source_pointer += g1_source->width*source_start_y + source_start_x;
 
-	if (!(g1_source->flags & 0x02)){
+	if (!(g1_source->flags & G1_FLAG_1)){
 		gfx_bmp_sprite_to_buffer(palette_pointer, unknown_pointer, source_pointer, dest_pointer, g1_source, dpi, height, width, image_type);
 		return;
 	}
@@ -55,6 +55,41 @@ static int _ttfGetWidthCacheCount = 0;
 static int _ttfGetWidthCacheHitCount = 0;
 static int _ttfGetWidthCacheMissCount = 0;
 
+#define TTF_GLYPH_CACHE_SIZE 2048
+#define TTF_GLYPH_ATLAS_SIZE 1024
+#define TTF_KERNING_CACHE_SIZE 1024
+
+typedef struct ttf_glyph {
+	TTF_Font *font;
+	uint16 codepoint;
+	uint16 atlas_x;
+	uint16 atlas_y;
+	uint8 width;
+	uint8 height;
+	sint16 offset_x;
+	sint16 offset_y;
+	sint16 advance;
+} ttf_glyph;
+
+typedef struct ttf_kerning_entry {
+	TTF_Font *font;
+	uint16 left;
+	uint16 right;
+	sint16 kerning;
+} ttf_kerning_entry;
+
+static ttf_glyph _ttfGlyphCache[TTF_GLYPH_CACHE_SIZE] = { 0 };
+static int _ttfGlyphCacheCount = 0;
+static ttf_kerning_entry _ttfKerningCache[TTF_KERNING_CACHE_SIZE] = { 0 };
+
+// Rasterised glyphs packed into shelves, a non zero byte is a set pixel
+static uint8 _ttfGlyphAtlas[TTF_GLYPH_ATLAS_SIZE * TTF_GLYPH_ATLAS_SIZE];
+static int _ttfGlyphAtlasShelfX = 0;
+static int _ttfGlyphAtlasShelfY = 0;
+static int _ttfGlyphAtlasShelfHeight = 0;
+
+ttf_glyph_cache_stats gTTFGlyphCacheStats;
+
 /**
  *
  *  rct2: 0x006C23B1
@@ -848,6 +883,149 @@ static uint32 _ttf_getwidth_cache_get_or_add(TTF_Font *font, const utf8 *text)
 	return entry->width;
 }
 
+static void _ttf_glyph_cache_dispose_all()
+{
+	memset(_ttfGlyphCache, 0, sizeof(_ttfGlyphCache));
+	memset(_ttfKerningCache, 0, sizeof(_ttfKerningCache));
+	_ttfGlyphCacheCount = 0;
+	_ttfGlyphAtlasShelfX = 0;
+	_ttfGlyphAtlasShelfY = 0;
+	_ttfGlyphAtlasShelfHeight = 0;
+}
+
+static uint32 _ttf_glyph_cache_hash(TTF_Font *font, uint16 codepoint)
+{
+	return ((((uint32)font >> 4) * 31) ^ (codepoint * 2654435761u)) % TTF_GLYPH_CACHE_SIZE;
+}
+
+/**
+ * Reserves space in the atlas for a glyph, returns false when the atlas is full.
+ */
+static bool _ttf_glyph_atlas_allocate(int width, int height, uint16 *outX, uint16 *outY)
+{
+	if (_ttfGlyphAtlasShelfX + width > TTF_GLYPH_ATLAS_SIZE) {
+		_ttfGlyphAtlasShelfY += _ttfGlyphAtlasShelfHeight;
+		_ttfGlyphAtlasShelfX = 0;
+		_ttfGlyphAtlasShelfHeight = 0;
+	}
+	if (_ttfGlyphAtlasShelfY + height > TTF_GLYPH_ATLAS_SIZE) {
+		return false;
+	}
+
+	*outX = _ttfGlyphAtlasShelfX;
+	*outY = _ttfGlyphAtlasShelfY;
+	_ttfGlyphAtlasShelfX += width;
+	_ttfGlyphAtlasShelfHeight = max(_ttfGlyphAtlasShelfHeight, height);
+	return true;
+}
+
+/**
+ * Returns the cached glyph for a character, rasterising it into the atlas if it has not been drawn before. When the
+ * cache or atlas fills up every glyph is dropped, so the returned glyph is only valid until the next call.
+ */
+static const ttf_glyph *_ttf_glyph_cache_get_or_add(TTF_Font *font, uint16 codepoint)
+{
+	ttf_glyph *entry;
+
+	uint32 index = _ttf_glyph_cache_hash(font, codepoint);
+	for (;;) {
+		entry = &_ttfGlyphCache[index];
+		if (entry->font == NULL) break;
+		if (entry->font == font && entry->codepoint == codepoint) {
+			gTTFGlyphCacheStats.hits++;
+			return entry;
+		}
+		if (++index >= TTF_GLYPH_CACHE_SIZE) index = 0;
+	}
+
+	int minX, maxX, minY, maxY, advance;
+	if (TTF_GlyphMetrics(font, codepoint, &minX, &maxX, &minY, &maxY, &advance) != 0) {
+		return NULL;
+	}
+
+	SDL_Color c = { 0, 0, 0, 255 };
+	SDL_Surface *surface = TTF_RenderGlyph_Solid(font, codepoint, c);
+	int width = 0;
+	int height = 0;
+	if (surface != NULL) {
+		width = min(surface->w, 255);
+		height = min(surface->h, 255);
+	}
+
+	uint16 atlasX, atlasY;
+	if (_ttfGlyphCacheCount >= TTF_GLYPH_CACHE_SIZE * 3 / 4 || !_ttf_glyph_atlas_allocate(width, height, &atlasX, &atlasY)) {
+		_ttf_glyph_cache_dispose_all();
+		_ttf_glyph_atlas_allocate(width, height, &atlasX, &atlasY);
+		gTTFGlyphCacheStats.flushes++;
+
+		index = _ttf_glyph_cache_hash(font, codepoint);
+		entry = &_ttfGlyphCache[index];
+	}
+
+	if (surface != NULL) {
+		if (!SDL_MUSTLOCK(surface) || SDL_LockSurface(surface) == 0) {
+			const uint8 *src = surface->pixels;
+			uint8 *dst = &_ttfGlyphAtlas[atlasY * TTF_GLYPH_ATLAS_SIZE + atlasX];
+			for (int y = 0; y < height; y++) {
+				memcpy(dst, src, width);
+				src += surface->pitch;
+				dst += TTF_GLYPH_ATLAS_SIZE;
+			}
+			if (SDL_MUSTLOCK(surface)) {
+				SDL_UnlockSurface(surface);
+			}
+		} else {
+			width = 0;
+			height = 0;
+		}
+		SDL_FreeSurface(surface);
+	}
+
+	gTTFGlyphCacheStats.rasterised++;
+
+	_ttfGlyphCacheCount++;
+	entry->font = font;
+	entry->codepoint = codepoint;
+	entry->atlas_x = atlasX;
+	entry->atlas_y = atlasY;
+	entry->width = width;
+	entry->height = height;
+	entry->offset_x = minX;
+	entry->offset_y = TTF_FontAscent(font) - maxY;
+	entry->advance = advance;
+	return entry;
+}
+
+/**
+ * Kerning between two characters, taken from how much SDL_ttf narrows the pair compared to the characters on their own.
+ */
+static int _ttf_kerning_get_or_add(TTF_Font *font, uint16 left, uint16 right)
+{
+	uint32 index = ((((uint32)font >> 4) * 31) ^ (left * 65599) ^ right) % TTF_KERNING_CACHE_SIZE;
+	ttf_kerning_entry *entry = &_ttfKerningCache[index];
+	if (entry->font == font && entry->left == left && entry->right == right) {
+		return entry->kerning;
+	}
+
+	utf8 pair[8];
+	utf8 *end = utf8_write_codepoint(pair, left);
+	utf8 *rightStart = end;
+	end = utf8_write_codepoint(end, right);
+	*end = 0;
+
+	int pairWidth, leftWidth, rightWidth, height;
+	TTF_SizeUTF8(font, pair, &pairWidth, &height);
+	TTF_SizeUTF8(font, rightStart, &rightWidth, &height);
+	*rightStart = 0;
+	TTF_SizeUTF8(font, pair, &leftWidth, &height);
+
+	entry->font = font;
+	entry->left = left;
+	entry->right = right;
+	entry->kerning = pairWidth - leftWidth - rightWidth;
+	return entry->kerning;
+}
+
 bool ttf_initialise()
 {
 	if (!_ttfInitialised) {
@@ -883,6 +1061,7 @@ void ttf_dispose()
 
 	_ttf_surface_cache_dispose_all();
 	_ttf_getwidth_cache_dispose_all();
+	_ttf_glyph_cache_dispose_all();
 
 	for (int i = 0; i < 4; i++) {
 		TTFFontDescriptor *fontDesc = &(gCurrentTTFFontSet->size[i]);
@@ -952,6 +1131,106 @@ static void ttf_draw_string_raw_sprite(rct_drawpixelinfo *dpi, const utf8 *text,
 	};
 }
 
+static void ttf_draw_glyph(rct_drawpixelinfo *dpi, const ttf_glyph *glyph, int x, int y, bool outline, text_draw_info *info)
+{
+	int drawX = x + glyph->offset_x;
+	int drawY = y + glyph->offset_y;
+	int width = glyph->width;
+	int height = glyph->height;
+
+	int overflowX = (dpi->x + dpi->width) - (drawX + width);
+	int overflowY = (dpi->y + dpi->height) - (drawY + height);
+	if (overflowX < 0) width += overflowX;
+	if (overflowY < 0) height += overflowY;
+	int skipX = drawX - dpi->x;
+	int skipY = drawY - dpi->y;
+
+	const uint8 *src = &_ttfGlyphAtlas[glyph->atlas_y * TTF_GLYPH_ATLAS_SIZE + glyph->atlas_x];
+	if (skipX < 0) {
+		width += skipX;
+		src += -skipX;
+		skipX = 0;
+	}
+	if (skipY < 0) {
+		height += skipY;
+		src += -skipY * TTF_GLYPH_ATLAS_SIZE;
+		skipY = 0;
+	}
+	if (width <= 0 || height <= 0) {
+		return;
+	}
+
+	int dstPitch = dpi->width + dpi->pitch;
+	uint8 *dst = dpi->bits + skipX + skipY * dstPitch;
+	uint8 colour = info->palette[1];
+	for (int yy = 0; yy < height; yy++) {
+		for (int xx = 0; xx < width; xx++) {
+			if (src[xx] == 0) {
+				continue;
+			}
+			if (outline) {
+				dst[xx + 1] = info->palette[3]; // right
+				dst[xx - 1] = info->palette[3]; // left
+				dst[xx - dstPitch] = info->palette[3]; // top
+				dst[xx + dstPitch] = info->palette[3]; // bottom
+			} else {
+				if (info->flags & TEXT_DRAW_FLAG_INSET) {
+					dst[xx + dstPitch + 1] = info->palette[3];
+				}
+				dst[xx] = colour;
+			}
+		}
+		src += TTF_GLYPH_ATLAS_SIZE;
+		dst += dstPitch;
+	}
+}
+
+/**
+ * Draws or measures a run of text from individually cached glyphs, so only characters that have not been seen before
+ * are rasterised. Returns false if the run has characters outside the range the SDL_ttf glyph functions accept.
+ */
+static bool ttf_draw_string_raw_glyphs(rct_drawpixelinfo *dpi, const utf8 *text, TTFFontDescriptor *fontDesc, text_draw_info *info)
+{
+	const utf8 *ch = text;
+	int codepoint;
+	while ((codepoint = utf8_get_next(ch, &ch)) != 0) {
+		if (codepoint > 0xFFFF) {
+			return false;
+		}
+	}
+
+	TTF_Font *font = fontDesc->font;
+	bool kerning = TTF_GetFontKerning(font) != 0;
+	bool draw = !(info->flags & TEXT_DRAW_FLAG_NO_DRAW);
+
+	// Outlines are drawn for the whole run first so they never cover a neighbouring glyph
+	int numPasses = draw && (info->flags & TEXT_DRAW_FLAG_OUTLINE) ? 2 : 1;
+	int x = info->x;
+	for (int pass = 0; pass < numPasses; pass++) {
+		bool outline = pass == 0 && numPasses == 2;
+		int previous = 0;
+		x = info->x;
+		ch = text;
+		while ((codepoint = utf8_get_next(ch, &ch)) != 0) {
+			if (kerning && previous != 0) {
+				x += _ttf_kerning_get_or_add(font, previous, codepoint);
+			}
+			const ttf_glyph *glyph = _ttf_glyph_cache_get_or_add(font, codepoint);
+			if (glyph == NULL) {
+				previous = 0;
+				continue;
+			}
+			if (draw) {
+				ttf_draw_glyph(dpi, glyph, x + fontDesc->offset_x, info->y + fontDesc->offset_y, outline, info);
+			}
+			x += glyph->advance;
+			previous = codepoint;
+		}
+	}
+	info->x = x;
+	return true;
+}
+
 static void ttf_draw_string_raw_ttf(rct_drawpixelinfo *dpi, const utf8 *text, text_draw_info *info)
 {
 	if (!_ttfInitialised && !ttf_initialise())
@@ -963,6 +1242,10 @@ static void ttf_draw_string_raw_ttf(rct_drawpixelinfo *dpi, const utf8 *text, te
 		return;
 	}
 
+	if (ttf_draw_string_raw_glyphs(dpi, text, fontDesc, info)) {
+		return;
+	}
+
 	if (info->flags & TEXT_DRAW_FLAG_NO_DRAW) {
 		info->x += _ttf_getwidth_cache_get_or_add(fontDesc->font, text);
 		return;
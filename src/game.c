@@ -38,6 +38,7 @@
 #include "peep/staff.h"
 #include "platform/platform.h"
 #include "rct1.h"
+#include "replay.h"
 #include "ride/ride.h"
 #include "ride/ride_ratings.h"
 #include "ride/vehicle.h"
@@ -355,6 +356,9 @@ void game_logic_update()
 			return;
 		}
 	}
+	// All game commands for this tick have now been run, compare / send the state checksum
+	network_update_state_checksum();
+	replay_update();
 	gCurrentTicks++;
 	gScenarioTicks++;
 	gScreenAge++;
@@ -512,6 +516,10 @@ int game_do_command_p(int command, int *eax, int *ebx, int *ecx, int *edx, int *
 				}
 			}
 
+			if (RCT2_GLOBAL(0x009A8C28, uint8) == 1 && !(flags & GAME_COMMAND_FLAG_GHOST) && !(flags & GAME_COMMAND_FLAG_5) && command != GAME_COMMAND_LOAD_OR_QUIT) {
+				replay_record_command(*eax, *ebx, *ecx, *edx, *esi, *edi, *ebp);
+			}
+
 			// Second call to actually perform the operation
 			new_game_command_table[command](eax, ebx, ecx, edx, esi, edi, ebp);
 
@@ -822,6 +830,9 @@ void game_load_init()
 {
 	rct_window *mainWindow;
 
+	// A recording only describes the park it was started on
+	replay_stop_recording();
+
 	gScreenFlags = SCREEN_FLAGS_PLAYING;
 	viewport_init_all();
 	game_create_windows();
@@ -102,73 +102,122 @@ bool image_io_png_read(uint8 **pixels, uint32 *width, uint32 *height, const utf8
 	return true;
 }
 
-bool image_io_png_write(const rct_drawpixelinfo *dpi, const rct_palette *palette, const utf8 *path)
+struct image_io_png_stream {
+	png_structp png_ptr;
+	png_infop info_ptr;
+	png_colorp png_palette;
+	SDL_RWops *file;
+};
+
+static void image_io_png_stream_close(image_io_png_stream *stream)
 {
-	// Get image size
-	int stride = dpi->width + dpi->pitch;
+	if (stream->png_palette != NULL) {
+		png_free(stream->png_ptr, stream->png_palette);
+	}
+	png_destroy_write_struct(&stream->png_ptr, &stream->info_ptr);
+	if (stream->file != NULL) {
+		SDL_RWclose(stream->file);
+	}
+	free(stream);
+}
+
+image_io_png_stream *image_io_png_write_begin(int width, int height, const rct_palette *palette, const utf8 *path)
+{
+	image_io_png_stream *stream = calloc(1, sizeof(image_io_png_stream));
+	if (stream == NULL) {
+		return NULL;
+	}
 
 	// Setup PNG
-	png_structp png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-	if (png_ptr == NULL) {
-		return false;
+	stream->png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	if (stream->png_ptr == NULL) {
+		free(stream);
+		return NULL;
 	}
 
-	png_infop info_ptr = png_create_info_struct(png_ptr);
-	if (info_ptr == NULL) {
-		png_destroy_write_struct(&png_ptr, (png_infopp)NULL);
-		return false;
+	stream->info_ptr = png_create_info_struct(stream->png_ptr);
+	if (stream->info_ptr == NULL) {
+		image_io_png_stream_close(stream);
+		return NULL;
 	}
 
-	png_colorp png_palette = (png_colorp)png_malloc(png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color));
+	stream->png_palette = (png_colorp)png_malloc(stream->png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color));
 	for (int i = 0; i < 256; i++) {
 		const rct_palette_entry *entry = &palette->entries[i];
-		png_palette[i].blue		= entry->blue;
-		png_palette[i].green	= entry->green;
-		png_palette[i].red		= entry->red;
+		stream->png_palette[i].blue		= entry->blue;
+		stream->png_palette[i].green	= entry->green;
+		stream->png_palette[i].red		= entry->red;
 	}
 
-	png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
+	png_set_PLTE(stream->png_ptr, stream->info_ptr, stream->png_palette, PNG_MAX_PALETTE_LENGTH);
 
 	// Open file for writing
-	SDL_RWops *file = SDL_RWFromFile(path, "wb");
-	if (file == NULL) {
-		png_free(png_ptr, png_palette);
-		png_destroy_write_struct(&png_ptr, (png_infopp)NULL);
-		return false;
+	stream->file = SDL_RWFromFile(path, "wb");
+	if (stream->file == NULL) {
+		image_io_png_stream_close(stream);
+		return NULL;
 	}
-	png_set_write_fn(png_ptr, file, my_png_write_data, my_png_flush);
+	png_set_write_fn(stream->png_ptr, stream->file, my_png_write_data, my_png_flush);
 
 	// Set error handler
-	if (setjmp(png_jmpbuf(png_ptr))) {
-		png_free(png_ptr, png_palette);
-		png_destroy_write_struct(&png_ptr, &info_ptr);
-		SDL_RWclose(file);
-		return false;
+	if (setjmp(png_jmpbuf(stream->png_ptr))) {
+		image_io_png_stream_close(stream);
+		return NULL;
 	}
 
 	// Write header
 	png_set_IHDR(
-		png_ptr, info_ptr, dpi->width, dpi->height, 8,
+		stream->png_ptr, stream->info_ptr, width, height, 8,
 		PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT
 	);
 	png_byte transparentIndex = 0;
-	png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, NULL);
-	png_write_info(png_ptr, info_ptr);
+	png_set_tRNS(stream->png_ptr, stream->info_ptr, &transparentIndex, 1, NULL);
+	png_write_info(stream->png_ptr, stream->info_ptr);
+	return stream;
+}
+
+bool image_io_png_write_rows(image_io_png_stream *stream, const rct_drawpixelinfo *dpi)
+{
+	// Set error handler
+	if (setjmp(png_jmpbuf(stream->png_ptr))) {
+		return false;
+	}
 
 	// Write pixels
+	int stride = dpi->width + dpi->pitch;
 	uint8 *bits = dpi->bits;
 	for (int y = 0; y < dpi->height; y++) {
-		png_write_row(png_ptr, (png_byte *)bits);
+		png_write_row(stream->png_ptr, (png_byte *)bits);
 		bits += stride;
 	}
+	return true;
+}
+
+bool image_io_png_write_end(image_io_png_stream *stream, bool success)
+{
+	if (success) {
+		// Set error handler
+		if (setjmp(png_jmpbuf(stream->png_ptr))) {
+			image_io_png_stream_close(stream);
+			return false;
+		}
+
+		// Finish
+		png_write_end(stream->png_ptr, NULL);
+	}
+	image_io_png_stream_close(stream);
+	return success;
+}
 
-	// Finish
-	png_write_end(png_ptr, NULL);
-	SDL_RWclose(file);
+bool image_io_png_write(const rct_drawpixelinfo *dpi, const rct_palette *palette, const utf8 *path)
+{
+	image_io_png_stream *stream = image_io_png_write_begin(dpi->width, dpi->height, palette, path);
+	if (stream == NULL) {
+		return false;
+	}
 
-	png_free(png_ptr, png_palette);
-	png_destroy_write_struct(&png_ptr, &info_ptr);
-	return true;
+	bool success = image_io_png_write_rows(stream, dpi);
+	return image_io_png_write_end(stream, success);
 }
 
 static void my_png_read_data(png_structp png_ptr, png_bytep data, png_size_t length)
@@ -23,6 +23,16 @@
 bool image_io_png_read(uint8 **pixels, uint32 *width, uint32 *height, const utf8 *path);
 
 bool image_io_png_write(const rct_drawpixelinfo *dpi, const rct_palette *palette, const utf8 *path);
+
+/**
+ * Writes a PNG a band of rows at a time, so that the whole image never has to be in memory. Rows are written from the
+ * top, each call to image_io_png_write_rows appends the rows of the given drawpixelinfo.
+ */
+typedef struct image_io_png_stream image_io_png_stream;
+
+image_io_png_stream *image_io_png_write_begin(int width, int height, const rct_palette *palette, const utf8 *path);
+bool image_io_png_write_rows(image_io_png_stream *stream, const rct_drawpixelinfo *dpi);
+bool image_io_png_write_end(image_io_png_stream *stream, bool success);
 bool image_io_bmp_write(const rct_drawpixelinfo *dpi, const rct_palette *palette, const utf8 *path);
 
 #endif
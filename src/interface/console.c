@@ -18,6 +18,7 @@
 #include <SDL_scancode.h>
 
 #include "../addresses.h"
+#include "../audio/audio.h"
 #include "../drawing/drawing.h"
 #include "../localisation/localisation.h"
 #include "../localisation/user.h"
@@ -28,11 +29,16 @@
 #include "../cursors.h"
 #include "../game.h"
 #include "../input.h"
+#include "../network/network.h"
 #include "../network/twitch.h"
 #include "../object.h"
+#include "../peep/peep.h"
+#include "../replay.h"
+#include "../ride/vehicle.h"
 #include "../world/banner.h"
 #include "../world/climate.h"
 #include "../world/scenery.h"
+#include "../world/sprite.h"
 #include "../management/finance.h"
 #include "../management/research.h"
 #include "../util/util.h"
@@ -467,6 +473,7 @@ static int cc_rides(const utf8 **argv, int argc)
 				if (int_valid[0] && int_valid[1] && (get_ride(int_val[0])->type != RIDE_TYPE_NULL)) {
 					rct_ride *ride = get_ride(int_val[0]);
 					ride->type = int_val[1];
+					park_update_ride_rating_inputs(int_val[0]);
 					if (int_valid[2]) {
 						ride->subtype = int_val[2];
 					}
@@ -913,6 +920,202 @@ static int cc_fix_banner_count(const utf8 **argv, int argc)
 	return 0;
 }
 
+static int cc_benchmark_peeps(const utf8 **argv, int argc)
+{
+	int ticks = 100;
+	int guests = 0;
+	bool valid;
+
+	if (argc > 0) {
+		ticks = console_parse_int(argv[0], &valid);
+		if (!valid || ticks <= 0) {
+			console_writeline_error("Invalid number of ticks.");
+			return 1;
+		}
+	}
+	if (argc > 1) {
+		guests = console_parse_int(argv[1], &valid);
+		if (!valid) {
+			console_writeline_error("Invalid number of guests.");
+			return 1;
+		}
+	}
+	if (network_get_mode() != NETWORK_MODE_NONE) {
+		console_writeline_error("Peeps can not be updated outside of the game loop in a network game.");
+		return 1;
+	}
+
+	// Add guests at the park entrance until there are enough or no more can be created
+	while (gSpriteListCount[SPRITE_LIST_PEEP] < guests) {
+		uint16 numPeeps = gSpriteListCount[SPRITE_LIST_PEEP];
+		generate_new_guest();
+		if (gSpriteListCount[SPRITE_LIST_PEEP] == numPeeps) {
+			break;
+		}
+	}
+
+	uint64 startTime = SDL_GetPerformanceCounter();
+	for (int i = 0; i < ticks; i++) {
+		peep_update_all();
+		gCurrentTicks++;
+	}
+	uint64 elapsed = SDL_GetPerformanceCounter() - startTime;
+
+	double msPerTick = (elapsed * 1000.0) / SDL_GetPerformanceFrequency() / ticks;
+	console_printf("%d peeps, %d ticks: %.3f ms per tick", gSpriteListCount[SPRITE_LIST_PEEP], ticks, msPerTick);
+	return 0;
+}
+
+static int cc_benchmark_map_lookups(const utf8 **argv, int argc)
+{
+	int iterations = 10;
+	bool valid;
+
+	if (argc > 0) {
+		iterations = console_parse_int(argv[0], &valid);
+		if (!valid || iterations <= 0) {
+			console_writeline_error("Invalid number of iterations.");
+			return 1;
+		}
+	}
+
+	// Look up each element type at the surface height of every tile, which mostly misses like most callers do
+	int found = 0;
+	uint64 startTime = SDL_GetPerformanceCounter();
+	for (int i = 0; i < iterations; i++) {
+		for (int y = 0; y < gMapSize; y++) {
+			for (int x = 0; x < gMapSize; x++) {
+				rct_map_element *surfaceElement = map_get_surface_element_at(x, y);
+				if (surfaceElement == NULL)
+					continue;
+
+				int z = surfaceElement->base_height;
+				if (map_get_path_element_at(x, y, z) != NULL) found++;
+				if (map_get_banner_element_at(x, y, z, 0) != NULL) found++;
+				if (map_get_fence_element_at(x << 5, y << 5, z, 0) != NULL) found++;
+				if (map_get_track_element_at(x << 5, y << 5, z) != NULL) found++;
+			}
+		}
+	}
+	uint64 elapsed = SDL_GetPerformanceCounter() - startTime;
+
+	int lookups = iterations * gMapSize * gMapSize * 4;
+	double nsPerLookup = (elapsed * 1000000000.0) / SDL_GetPerformanceFrequency() / lookups;
+	console_printf("%d lookups, %d found: %.1f ns per lookup", lookups, found, nsPerLookup);
+	return 0;
+}
+
+static int cc_benchmark_vehicle_sounds(const utf8 **argv, int argc)
+{
+	int iterations = 100;
+	bool valid;
+
+	if (argc > 0) {
+		iterations = console_parse_int(argv[0], &valid);
+		if (!valid || iterations <= 0) {
+			console_writeline_error("Invalid number of iterations.");
+			return 1;
+		}
+	}
+	if (gAudioCurrentDevice == -1 || gGameSoundsOff || !gConfigSound.sound_enabled) {
+		console_writeline_error("Vehicle sounds are only updated when sound is enabled.");
+		return 1;
+	}
+
+	uint64 startTime = SDL_GetPerformanceCounter();
+	for (int i = 0; i < iterations; i++) {
+		vehicle_sounds_update();
+	}
+	uint64 elapsed = SDL_GetPerformanceCounter() - startTime;
+
+	double usPerUpdate = (elapsed * 1000000.0) / SDL_GetPerformanceFrequency() / iterations;
+	console_printf("%d cars, %d updates: %.1f us per update", gSpriteListCount[SPRITE_LIST_VEHICLE], iterations, usPerUpdate);
+	return 0;
+}
+
+static int cc_sprite_invalidations(const utf8 **argv, int argc)
+{
+	if (argc > 0) {
+		if (strcmp(argv[0], "on") == 0) {
+			gSpriteInvalidationStatsEnabled = true;
+		} else if (strcmp(argv[0], "off") == 0) {
+			gSpriteInvalidationStatsEnabled = false;
+		}
+	}
+
+	if (!gSpriteInvalidationStatsEnabled) {
+		console_writeline("Sprite invalidation counters are off.");
+		return 0;
+	}
+
+	console_printf("Rectangles: %u queued, %u after merging", gSpriteInvalidationStats.queued, gSpriteInvalidationStats.flushed);
+	console_printf("Dirty blocks: %u before merging, %u after merging", gSpriteInvalidationStats.blocks_before, gSpriteInvalidationStats.blocks_after);
+	return 0;
+}
+
+static int cc_format_cache(const utf8 **argv, int argc)
+{
+	if (argc > 0 && strcmp(argv[0], "reset") == 0) {
+		memset(&gFormatStringCacheStats, 0, sizeof(gFormatStringCacheStats));
+	}
+
+	uint32 lookups = gFormatStringCacheStats.hits + gFormatStringCacheStats.misses;
+	console_printf("Cached strings: %u hits, %u misses (%u%% hit rate)", gFormatStringCacheStats.hits, gFormatStringCacheStats.misses, lookups == 0 ? 0 : (uint32)((uint64)gFormatStringCacheStats.hits * 100 / lookups));
+	console_printf("Uncacheable strings: %u", gFormatStringCacheStats.uncacheable);
+	return 0;
+}
+
+static int cc_glyph_cache(const utf8 **argv, int argc)
+{
+	if (argc > 0 && strcmp(argv[0], "reset") == 0) {
+		memset(&gTTFGlyphCacheStats, 0, sizeof(gTTFGlyphCacheStats));
+	}
+
+	console_printf("TrueType glyphs: %u drawn from the atlas, %u rasterised", gTTFGlyphCacheStats.hits, gTTFGlyphCacheStats.rasterised);
+	console_printf("Atlas flushes: %u", gTTFGlyphCacheStats.flushes);
+	return 0;
+}
+
+static int cc_draw_stats(const utf8 **argv, int argc)
+{
+	if (argc > 0 && strcmp(argv[0], "reset") == 0) {
+		memset(&gWindowDrawStats, 0, sizeof(gWindowDrawStats));
+	}
+
+	uint64 visible = gWindowDrawStats.visible;
+	uint64 painted = gWindowDrawStats.painted;
+	console_printf("Pixels redrawn: %llu, painted: %llu (%u%% overdraw)", (unsigned long long)visible, (unsigned long long)painted, painted <= visible ? 0 : (uint32)(((painted - visible) * 100) / visible));
+	console_printf("Regions painted: %u, covered windows skipped: %u", gWindowDrawStats.regions, gWindowDrawStats.skipped);
+	return 0;
+}
+
+static int cc_replay_record(const utf8 **argv, int argc)
+{
+	if (argc == 0) {
+		console_writeline_error("Expected a path to record to.");
+		return 1;
+	}
+
+	if (!replay_start_recording(argv[0])) {
+		console_printf("Unable to record to %s", argv[0]);
+		return 1;
+	}
+	console_printf("Recording game commands to %s", argv[0]);
+	return 0;
+}
+
+static int cc_replay_stop(const utf8 **argv, int argc)
+{
+	if (!replay_is_recording()) {
+		console_writeline("Not recording.");
+		return 0;
+	}
+
+	replay_stop_recording();
+	console_writeline("Recording stopped.");
+	return 0;
+}
+
 static int cc_open(const utf8 **argv, int argc) {
 	if (argc > 0) {
 		bool title = (gScreenFlags & SCREEN_FLAGS_TITLE_DEMO) != 0;
@@ -1007,6 +1210,15 @@ console_command console_command_table[] = {
 	{ "reset_user_strings", cc_reset_user_strings, "Resets all user-defined strings, to fix incorrectly occurring 'Chosen name in use already' errors.", "reset_user_strings" },
 	{ "fix_banner_count", cc_fix_banner_count, "Fixes incorrectly appearing 'Too many banners' error by marking every banner entry without a map element as null.", "fix_banner_count" },
 	{ "rides", cc_rides, "Ride management.", "rides <subcommand>" },
+	{ "benchmark_peeps", cc_benchmark_peeps, "Times peep_update_all over a number of ticks, first adding guests until there are at least the given number of peeps.", "benchmark_peeps [ticks] [guests]" },
+	{ "benchmark_map_lookups", cc_benchmark_map_lookups, "Times the path, banner, fence and track element lookups at the surface height of every tile.", "benchmark_map_lookups [iterations]" },
+	{ "benchmark_vehicle_sounds", cc_benchmark_vehicle_sounds, "Times vehicle_sounds_update for the cars in the park over a number of updates.", "benchmark_vehicle_sounds [iterations]" },
+	{ "format_cache", cc_format_cache, "Shows how often formatted strings were served from the string cache.", "format_cache [reset]" },
+	{ "glyph_cache", cc_glyph_cache, "Shows how many TrueType glyphs were drawn from the glyph atlas and how many had to be rasterised.", "glyph_cache [reset]" },
+	{ "draw_stats", cc_draw_stats, "Shows how many pixels window paint events painted compared to the screen area that was redrawn.", "draw_stats [reset]" },
+	{ "replay_record", cc_replay_record, "Records the park and every game command from now on, play it back with the replay command line option.", "replay_record <path>" },
+	{ "replay_stop", cc_replay_stop, "Stops recording game commands.", "replay_stop" },
+	{ "sprite_invalidations", cc_sprite_invalidations, "Shows the dirty blocks produced by sprite invalidations in the last frame, before and after merging.", "sprite_invalidations [on|off]" },
 };
 
 static int cc_windows(const utf8 **argv, int argc) {
@@ -22,13 +22,18 @@
 #include "../image_io.h"
 #include "../intro.h"
 #include "../localisation/localisation.h"
+#include "../object.h"
 #include "../openrct2.h"
 #include "../platform/platform.h"
+#include "../rct2.h"
 #include "../util/util.h"
 #include "../windows/error.h"
 #include "screenshot.h"
 #include "viewport.h"
 
+// Number of rows rendered at a time for viewport screenshots, kept below the 384 rows viewport_render paints at once
+#define SCREENSHOT_BAND_HEIGHT 256
+
 static const char *_screenshot_format_extension[] = { ".bmp", ".png" };
 
 static int screenshot_dump_bmp();
@@ -159,6 +164,40 @@ int screenshot_dump_png()
 	}
 }
 
+/**
+ * Renders the whole viewport to a PNG one band of rows at a time, so giant screenshots only need memory for one band.
+ */
+static bool screenshot_render_viewport_png(rct_viewport *viewport, const utf8 *path)
+{
+	rct_palette renderedPalette;
+	screenshot_get_rendered_palette(&renderedPalette);
+
+	image_io_png_stream *stream = image_io_png_write_begin(viewport->width, viewport->height, &renderedPalette, path);
+	if (stream == NULL) {
+		return false;
+	}
+
+	rct_drawpixelinfo dpi;
+	dpi.x = 0;
+	dpi.width = viewport->width;
+	dpi.pitch = 0;
+	dpi.zoom_level = 0;
+	dpi.bits = malloc(dpi.width * SCREENSHOT_BAND_HEIGHT);
+
+	bool success = dpi.bits != NULL;
+	for (int top = 0; success && top < viewport->height; top += SCREENSHOT_BAND_HEIGHT) {
+		dpi.y = top;
+		dpi.height = min(SCREENSHOT_BAND_HEIGHT, viewport->height - top);
+		memset(dpi.bits, 0, dpi.width * dpi.height);
+
+		viewport_render(&dpi, viewport, 0, top, viewport->width, top + dpi.height);
+		success = image_io_png_write_rows(stream, &dpi);
+	}
+
+	free(dpi.bits);
+	return image_io_png_write_end(stream, success);
+}
+
 void screenshot_giant()
 {
 	int originalRotation = get_current_rotation();
@@ -219,17 +258,6 @@ void screenshot_giant()
 	// Ensure sprites appear regardless of rotation
 	reset_all_sprite_quadrant_placements();
 
-	rct_drawpixelinfo dpi;
-	dpi.x = 0;
-	dpi.y = 0;
-	dpi.width = resolutionWidth;
-	dpi.height = resolutionHeight;
-	dpi.pitch = 0;
-	dpi.zoom_level = 0;
-	dpi.bits = malloc(dpi.width * dpi.height);
-
-	viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
-
 	// Get a free screenshot path
 	char path[MAX_PATH];
 	int index;
@@ -239,12 +267,11 @@ void screenshot_giant()
 		return;
 	}
 
-	rct_palette renderedPalette;
-	screenshot_get_rendered_palette(&renderedPalette);
-
-	image_io_png_write(&dpi, &renderedPalette, path);
-
-	free(dpi.bits);
+	if (!screenshot_render_viewport_png(&viewport, path)) {
+		log_error("Giant screenshot failed, unable to write %s.", path);
+		window_error_open(STR_SCREENSHOT_FAILED, -1);
+		return;
+	}
 
 	// Show user that screenshot saved successfully
 	rct_string_id stringId = 3165;
@@ -253,136 +280,242 @@ void screenshot_giant()
 	window_error_open(STR_SCREENSHOT_SAVED_AS, -1);
 }
 
-int cmdline_for_screenshot(const char **argv, int argc)
+typedef struct screenshot_options {
+	const char *input_path;
+	const char *output_path;
+	int width, height;
+	bool custom_location;
+	bool centre_map_x, centre_map_y;
+	int x, y, zoom, rotation;
+} screenshot_options;
+
+static bool screenshot_parse_options(const char **argv, int argc, screenshot_options *options)
 {
 	bool giantScreenshot = argc == 5 && _stricmp(argv[2], "giant") == 0;
 	if (argc != 4 && argc != 8 && !giantScreenshot) {
-		printf("Usage: openrct2 screenshot <file> <ouput_image> <width> <height> [<x> <y> <zoom> <rotation>]\n");
-		printf("Usage: openrct2 screenshot <file> <ouput_image> giant <zoom> <rotation>\n");
-		return -1;
+		return false;
 	}
 
-	bool customLocation = false;
-	bool centreMapX = false;
-	bool centreMapY = false;
-	int resolutionWidth, resolutionHeight, customX, customY, customZoom, customRotation;
-
-	const char *inputPath = argv[0];
-	const char *outputPath = argv[1];
+	memset(options, 0, sizeof(screenshot_options));
+	options->input_path = argv[0];
+	options->output_path = argv[1];
 	if (giantScreenshot) {
-		resolutionWidth = 0;
-		resolutionHeight = 0;
-		customLocation = true;
-		centreMapX = true;
-		centreMapY = true;
-		customZoom = atoi(argv[3]);
-		customRotation = atoi(argv[4]) & 3;
+		options->width = 0;
+		options->height = 0;
+		options->custom_location = true;
+		options->centre_map_x = true;
+		options->centre_map_y = true;
+		options->zoom = atoi(argv[3]);
+		options->rotation = atoi(argv[4]) & 3;
 	} else {
-		resolutionWidth = atoi(argv[2]);
-		resolutionHeight = atoi(argv[3]);
+		options->width = atoi(argv[2]);
+		options->height = atoi(argv[3]);
 		if (argc == 8) {
-			customLocation = true;
+			options->custom_location = true;
 			if (argv[4][0] == 'c')
-				centreMapX = true;
+				options->centre_map_x = true;
 			else
-				customX = atoi(argv[4]);
+				options->x = atoi(argv[4]);
 			if (argv[5][0] == 'c')
-				centreMapY = true;
+				options->centre_map_y = true;
 			else
-				customY = atoi(argv[5]);
+				options->y = atoi(argv[5]);
 
-			customZoom = atoi(argv[6]);
-			customRotation = atoi(argv[7]) & 3;
+			options->zoom = atoi(argv[6]);
+			options->rotation = atoi(argv[7]) & 3;
 		} else {
-			customZoom = 0;
+			options->zoom = 0;
 		}
 	}
+	return true;
+}
 
-	gOpenRCT2Headless = true;
-	if (openrct2_initialise()) {
-		rct2_open_file(inputPath);
+static void screenshot_print_usage()
+{
+	printf("Usage: openrct2 screenshot <file> <ouput_image> <width> <height> [<x> <y> <zoom> <rotation>]\n");
+	printf("Usage: openrct2 screenshot <file> <ouput_image> giant <zoom> <rotation>\n");
+	printf("Usage: openrct2 screenshot batch <manifest>\n");
+}
 
-		gIntroState = INTRO_STATE_NONE;
-		gScreenFlags = SCREEN_FLAGS_PLAYING;
+/**
+ * Loads the park and renders the view described by the options, openrct2_initialise must have been called.
+ */
+static bool screenshot_render_park(const screenshot_options *options)
+{
+	if (get_file_extension_type(options->input_path) == FILE_EXTENSION_SV6) {
+		if (!game_load_save(options->input_path)) {
+			log_error("Unable to load %s.", options->input_path);
+			return false;
+		}
+	} else {
+		rct2_open_file(options->input_path);
+	}
 
-		int mapSize = gMapSize;
-		if (resolutionWidth == 0 || resolutionHeight == 0) {
-			resolutionWidth = (mapSize * 32 * 2) >> customZoom;
-			resolutionHeight = (mapSize * 32 * 1) >> customZoom;
+	gIntroState = INTRO_STATE_NONE;
+	gScreenFlags = SCREEN_FLAGS_PLAYING;
 
-			resolutionWidth += 8;
-			resolutionHeight += 128;
-		}
+	int mapSize = gMapSize;
+	int resolutionWidth = options->width;
+	int resolutionHeight = options->height;
+	if (resolutionWidth == 0 || resolutionHeight == 0) {
+		resolutionWidth = (mapSize * 32 * 2) >> options->zoom;
+		resolutionHeight = (mapSize * 32 * 1) >> options->zoom;
+
+		resolutionWidth += 8;
+		resolutionHeight += 128;
+	}
 
-		rct_viewport viewport;
-		viewport.x = 0;
-		viewport.y = 0;
-		viewport.width = resolutionWidth;
-		viewport.height = resolutionHeight;
-		viewport.view_width = viewport.width;
-		viewport.view_height = viewport.height;
-		viewport.var_11 = 0;
-		viewport.flags = 0;
-
-		if (customLocation) {
-			if (centreMapX)
-				customX = (mapSize / 2) * 32 + 16;
-			if (centreMapY)
-				customY = (mapSize / 2) * 32 + 16;
-
-			int x, y;
-			int z = map_element_height(customX, customY) & 0xFFFF;
-			switch (customRotation) {
-			case 0:
-				x = customY - customX;
-				y = ((customX + customY) / 2) - z;
-				break;
-			case 1:
-				x = -customY - customX;
-				y = ((-customX + customY) / 2) - z;
-				break;
-			case 2:
-				x = -customY + customX;
-				y = ((-customX - customY) / 2) - z;
-				break;
-			case 3:
-				x = customY + customX;
-				y = ((customX - customY) / 2) - z;
-				break;
-			}
+	rct_viewport viewport;
+	viewport.x = 0;
+	viewport.y = 0;
+	viewport.width = resolutionWidth;
+	viewport.height = resolutionHeight;
+	viewport.view_width = viewport.width;
+	viewport.view_height = viewport.height;
+	viewport.var_11 = 0;
+	viewport.flags = 0;
 
-			viewport.view_x = x - ((viewport.view_width << customZoom) / 2);
-			viewport.view_y = y - ((viewport.view_height << customZoom) / 2);
-			viewport.zoom = customZoom;
-			gCurrentRotation = customRotation;
-		} else {
-			viewport.view_x = gSavedViewX - (viewport.view_width / 2);
-			viewport.view_y = gSavedViewY - (viewport.view_height / 2);
-			viewport.zoom = gSavedViewZoom;
-			gCurrentRotation = gSavedViewRotation;
+	if (options->custom_location) {
+		int customX = options->x;
+		int customY = options->y;
+		if (options->centre_map_x)
+			customX = (mapSize / 2) * 32 + 16;
+		if (options->centre_map_y)
+			customY = (mapSize / 2) * 32 + 16;
+
+		int x, y;
+		int z = map_element_height(customX, customY) & 0xFFFF;
+		switch (options->rotation) {
+		case 0:
+			x = customY - customX;
+			y = ((customX + customY) / 2) - z;
+			break;
+		case 1:
+			x = -customY - customX;
+			y = ((-customX + customY) / 2) - z;
+			break;
+		case 2:
+			x = -customY + customX;
+			y = ((-customX - customY) / 2) - z;
+			break;
+		case 3:
+			x = customY + customX;
+			y = ((customX - customY) / 2) - z;
+			break;
 		}
 
-		// Ensure sprites appear regardless of rotation
-		reset_all_sprite_quadrant_placements();
-
-		rct_drawpixelinfo dpi;
-		dpi.x = 0;
-		dpi.y = 0;
-		dpi.width = resolutionWidth;
-		dpi.height = resolutionHeight;
-		dpi.pitch = 0;
-		dpi.zoom_level = 0;
-		dpi.bits = malloc(dpi.width * dpi.height);
+		viewport.view_x = x - ((viewport.view_width << options->zoom) / 2);
+		viewport.view_y = y - ((viewport.view_height << options->zoom) / 2);
+		viewport.zoom = options->zoom;
+		gCurrentRotation = options->rotation;
+	} else {
+		viewport.view_x = gSavedViewX - (viewport.view_width / 2);
+		viewport.view_y = gSavedViewY - (viewport.view_height / 2);
+		viewport.zoom = gSavedViewZoom;
+		gCurrentRotation = gSavedViewRotation;
+	}
 
-		viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
+	// Ensure sprites appear regardless of rotation
+	reset_all_sprite_quadrant_placements();
 
-		rct_palette renderedPalette;
-		screenshot_get_rendered_palette(&renderedPalette);
+	if (!screenshot_render_viewport_png(&viewport, options->output_path)) {
+		log_error("Unable to write screenshot to %s.", options->output_path);
+		return false;
+	}
+	return true;
+}
 
-		image_io_png_write(&dpi, &renderedPalette, outputPath);
+int cmdline_for_screenshot(const char **argv, int argc)
+{
+	screenshot_options options;
+	if (!screenshot_parse_options(argv, argc, &options)) {
+		screenshot_print_usage();
+		return -1;
+	}
 
-		free(dpi.bits);
+	gOpenRCT2Headless = true;
+	if (openrct2_initialise()) {
+		screenshot_render_park(&options);
 	}
 	openrct2_dispose();
 	return 1;
 }
+
+/**
+ * Splits a manifest line into whitespace separated arguments, double quotes group arguments containing spaces.
+ * The line is modified in place.
+ */
+static int screenshot_split_manifest_line(char *line, const char **argv, int maxArgs)
+{
+	int argc = 0;
+	char *ch = line;
+	for (;;) {
+		while (*ch == ' ' || *ch == '\t' || *ch == '\r' || *ch == '\n')
+			ch++;
+		if (*ch == '\0' || *ch == '#')
+			break;
+		if (argc >= maxArgs)
+			return -1;
+
+		char terminator = ' ';
+		if (*ch == '"') {
+			terminator = '"';
+			ch++;
+		}
+		argv[argc++] = ch;
+		while (*ch != '\0' && *ch != terminator && !(terminator == ' ' && (*ch == '\t' || *ch == '\r' || *ch == '\n')))
+			ch++;
+		if (*ch == '\0')
+			break;
+		*ch++ = '\0';
+	}
+	return argc;
+}
+
+/**
+ * Renders every screenshot listed in a manifest in a single process. Each line of the manifest takes the same arguments
+ * as the screenshot command, lines starting with # are ignored. Objects shared between consecutive parks stay loaded.
+ */
+int cmdline_for_screenshot_batch(const char *manifestPath)
+{
+	FILE *manifest = fopen(manifestPath, "r");
+	if (manifest == NULL) {
+		log_error("Unable to open manifest %s.", manifestPath);
+		return -1;
+	}
+
+	int numFailed = 0;
+	gOpenRCT2Headless = true;
+	if (openrct2_initialise()) {
+		gObjectKeepLoadedEntries = true;
+
+		char line[1024];
+		int lineNumber = 0;
+		while (fgets(line, sizeof(line), manifest) != NULL) {
+			lineNumber++;
+
+			const char *argv[8];
+			int argc = screenshot_split_manifest_line(line, argv, countof(argv));
+			if (argc == 0)
+				continue;
+
+			screenshot_options options;
+			if (argc < 0 || !screenshot_parse_options(argv, argc, &options)) {
+				log_error("%s:%d: invalid screenshot entry.", manifestPath, lineNumber);
+				numFailed++;
+				continue;
+			}
+
+			if (!screenshot_render_park(&options)) {
+				numFailed++;
+			}
+		}
+
+		gObjectKeepLoadedEntries = false;
+	} else {
+		numFailed++;
+	}
+	openrct2_dispose();
+	fclose(manifest);
+	return numFailed == 0 ? 1 : -1;
+}
@@ -22,5 +22,6 @@ int screenshot_dump();
 
 void screenshot_giant();
 int cmdline_for_screenshot(const char **argv, int argc);
+int cmdline_for_screenshot_batch(const char *manifestPath);
 
 #endif
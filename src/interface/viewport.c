@@ -1399,6 +1399,105 @@ void sub_68862C()
 	}
 }
 
+// Results of recent hit tests, a hit test is a complete paint pass for one pixel so repeated tests of the same
+// pixel are answered from here until something is drawn differently at that pixel
+#define VIEWPORT_INTERACTION_CACHE_SIZE 4
+
+typedef struct viewport_interaction_cache_entry {
+	uint32 generation;
+	rct_viewport *viewport;
+	sint16 view_x;
+	sint16 view_y;
+	uint16 flags;
+	uint16 viewport_flags;
+	uint8 zoom;
+	uint8 rotation;
+	uint8 interaction_type;
+	uint8 var_29;
+	sint16 x;
+	sint16 y;
+	rct_map_element *map_element;
+} viewport_interaction_cache_entry;
+
+static viewport_interaction_cache_entry _viewportInteractionCache[VIEWPORT_INTERACTION_CACHE_SIZE];
+static int _viewportInteractionCacheNextSlot = 0;
+static uint32 _viewportInteractionCacheGeneration = 1;
+
+/**
+ * Discards all cached hit test results, called when the whole map may have changed.
+ */
+void viewport_interaction_cache_invalidate()
+{
+	_viewportInteractionCacheGeneration++;
+}
+
+/**
+ * Discards cached hit test results for pixels within the given area of the view (zoom 0 coordinates), called
+ * whenever something that can be hit is drawn differently there.
+ */
+void viewport_interaction_cache_invalidate_rect(int left, int top, int right, int bottom)
+{
+	for (int i = 0; i < VIEWPORT_INTERACTION_CACHE_SIZE; i++) {
+		viewport_interaction_cache_entry *entry = &_viewportInteractionCache[i];
+		if (entry->view_x >= left && entry->view_x <= right && entry->view_y >= top && entry->view_y <= bottom) {
+			entry->generation = 0;
+		}
+	}
+}
+
+/**
+ * Discards cached hit test results that point to any of the given map elements, called when map elements are
+ * moved within the element list.
+ */
+void viewport_interaction_cache_invalidate_elements(rct_map_element *first, rct_map_element *last)
+{
+	for (int i = 0; i < VIEWPORT_INTERACTION_CACHE_SIZE; i++) {
+		viewport_interaction_cache_entry *entry = &_viewportInteractionCache[i];
+		if (entry->map_element >= first && entry->map_element <= last) {
+			entry->generation = 0;
+		}
+	}
+}
+
+static viewport_interaction_cache_entry *viewport_interaction_cache_find(rct_viewport *viewport, sint16 viewX, sint16 viewY, uint16 flags)
+{
+	for (int i = 0; i < VIEWPORT_INTERACTION_CACHE_SIZE; i++) {
+		viewport_interaction_cache_entry *entry = &_viewportInteractionCache[i];
+		if (entry->generation == _viewportInteractionCacheGeneration &&
+			entry->viewport == viewport &&
+			entry->view_x == viewX &&
+			entry->view_y == viewY &&
+			entry->flags == flags &&
+			entry->viewport_flags == viewport->flags &&
+			entry->zoom == viewport->zoom &&
+			entry->rotation == get_current_rotation()
+		) {
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+static void viewport_interaction_cache_add(rct_viewport *viewport, sint16 viewX, sint16 viewY, uint16 flags)
+{
+	viewport_interaction_cache_entry *entry = &_viewportInteractionCache[_viewportInteractionCacheNextSlot];
+	_viewportInteractionCacheNextSlot = (_viewportInteractionCacheNextSlot + 1) % VIEWPORT_INTERACTION_CACHE_SIZE;
+
+	entry->generation = _viewportInteractionCacheGeneration;
+	entry->viewport = viewport;
+	entry->view_x = viewX;
+	entry->view_y = viewY;
+	entry->flags = flags;
+	entry->viewport_flags = viewport->flags;
+	entry->zoom = viewport->zoom;
+	entry->rotation = get_current_rotation();
+	entry->interaction_type = RCT2_GLOBAL(0x9AC148, uint8_t);
+	entry->var_29 = RCT2_GLOBAL(0x9AC149, uint8_t);
+	entry->x = RCT2_GLOBAL(0x9AC14C, int16_t);
+	entry->y = RCT2_GLOBAL(0x9AC14E, int16_t);
+	entry->map_element = RCT2_GLOBAL(0x9AC150, rct_map_element*);
+}
+
 /**
  *
  *  rct2: 0x00685ADC
@@ -1434,6 +1533,22 @@ void get_map_coordinates_from_pos(int screenX, int screenY, int flags, sint16 *x
 			screenY &= (0xFFFF << myviewport->zoom) & 0xFFFF;
 			RCT2_GLOBAL(RCT2_ADDRESS_VIEWPORT_PAINT_X, int16_t) = screenX;
 			RCT2_GLOBAL(RCT2_ADDRESS_VIEWPORT_PAINT_Y, int16_t) = screenY;
+
+			viewport_interaction_cache_entry *cached = viewport_interaction_cache_find(myviewport, screenX, screenY, flags & 0xFFFF);
+			if (cached != NULL) {
+				RCT2_GLOBAL(0x9AC148, uint8_t) = cached->interaction_type;
+				RCT2_GLOBAL(0x9AC149, uint8_t) = cached->var_29;
+				RCT2_GLOBAL(0x9AC14C, int16_t) = cached->x;
+				RCT2_GLOBAL(0x9AC14E, int16_t) = cached->y;
+				RCT2_GLOBAL(0x9AC150, rct_map_element*) = cached->map_element;
+				if (viewport != NULL) *viewport = myviewport;
+				if (interactionType != NULL) *interactionType = cached->interaction_type;
+				if (x != NULL) *x = cached->x;
+				if (y != NULL) *y = cached->y;
+				if (mapElement != NULL) *mapElement = cached->map_element;
+				return;
+			}
+
 			rct_drawpixelinfo* dpi = RCT2_ADDRESS(RCT2_ADDRESS_VIEWPORT_DPI, rct_drawpixelinfo);
 			dpi->y = RCT2_GLOBAL(RCT2_ADDRESS_VIEWPORT_PAINT_Y, int16_t);
 			dpi->height = 1;
@@ -1446,6 +1561,7 @@ void get_map_coordinates_from_pos(int screenX, int screenY, int flags, sint16 *x
 			viewport_paint_setup();
 			sub_688217();
 			sub_68862C();
+			viewport_interaction_cache_add(myviewport, screenX, screenY, flags & 0xFFFF);
 		}
 		if (viewport != NULL) *viewport = myviewport;
 	}
@@ -1458,35 +1574,58 @@ void get_map_coordinates_from_pos(int screenX, int screenY, int flags, sint16 *x
 /**
  * Left, top, right and bottom represent 2D map coordinates at zoom 0.
  */
-void viewport_invalidate(rct_viewport *viewport, int left, int top, int right, int bottom)
+/**
+ * Converts a rectangle in view coordinates into screen coordinates of the given viewport.
+ * @returns false if the rectangle is not within the viewport.
+ */
+static bool viewport_get_screen_rect(rct_viewport *viewport, int *left, int *top, int *right, int *bottom)
 {
 	int viewportLeft = viewport->view_x;
 	int viewportTop = viewport->view_y;
 	int viewportRight = viewport->view_x + viewport->view_width;
 	int viewportBottom = viewport->view_y + viewport->view_height;
-	if (right > viewportLeft && bottom > viewportTop) {
-		left = max(left, viewportLeft);
-		top = max(top, viewportTop);
-		right = min(right, viewportRight);
-		bottom = min(bottom, viewportBottom);
-
-		uint8 zoom = 1 << viewport->zoom;
-		left -= viewportLeft;
-		top -= viewportTop;
-		right -= viewportLeft;
-		bottom -= viewportTop;
-		left /= zoom;
-		top /= zoom;
-		right /= zoom;
-		bottom /= zoom;
-		left += viewport->x;
-		top += viewport->y;
-		right += viewport->x;
-		bottom += viewport->y;
+	if (*right <= viewportLeft || *bottom <= viewportTop)
+		return false;
+
+	*left = max(*left, viewportLeft);
+	*top = max(*top, viewportTop);
+	*right = min(*right, viewportRight);
+	*bottom = min(*bottom, viewportBottom);
+
+	uint8 zoom = 1 << viewport->zoom;
+	*left -= viewportLeft;
+	*top -= viewportTop;
+	*right -= viewportLeft;
+	*bottom -= viewportTop;
+	*left /= zoom;
+	*top /= zoom;
+	*right /= zoom;
+	*bottom /= zoom;
+	*left += viewport->x;
+	*top += viewport->y;
+	*right += viewport->x;
+	*bottom += viewport->y;
+	return true;
+}
+
+void viewport_invalidate(rct_viewport *viewport, int left, int top, int right, int bottom)
+{
+	if (viewport_get_screen_rect(viewport, &left, &top, &right, &bottom)) {
 		gfx_set_dirty_blocks(left, top, right, bottom);
 	}
 }
 
+/**
+ * Gets the number of dirty blocks viewport_invalidate would mark for the given rectangle.
+ */
+uint32 viewport_get_invalidate_block_count(rct_viewport *viewport, int left, int top, int right, int bottom)
+{
+	if (!viewport_get_screen_rect(viewport, &left, &top, &right, &bottom))
+		return 0;
+
+	return gfx_get_dirty_block_count(left, top, right, bottom);
+}
+
 rct_viewport *viewport_find_from_point(int screenX, int screenY)
 {
 	rct_window *w;
@@ -119,6 +119,9 @@ void show_construction_rights();
 void hide_construction_rights();
 void viewport_set_visibility(uint8 mode);
 
+void viewport_interaction_cache_invalidate();
+void viewport_interaction_cache_invalidate_rect(int left, int top, int right, int bottom);
+void viewport_interaction_cache_invalidate_elements(rct_map_element *first, rct_map_element *last);
 void get_map_coordinates_from_pos(int screenX, int screenY, int flags, sint16 *x, sint16 *y, int *interactionType, rct_map_element **mapElement, rct_viewport **viewport);
 
 int viewport_interaction_get_item_left(int x, int y, viewport_interaction_info *info);
@@ -137,6 +140,7 @@ void paint_quadrant_ps();
 void sub_688217();
 
 void viewport_invalidate(rct_viewport *viewport, int left, int top, int right, int bottom);
+uint32 viewport_get_invalidate_block_count(rct_viewport *viewport, int left, int top, int right, int bottom);
 
 void screen_get_map_xy(int screenX, int screenY, sint16 *x, sint16 *y, rct_viewport **viewport);
 void screen_get_map_xy_with_z(sint16 screenX, sint16 screenY, sint16 z, sint16 *mapX, sint16 *mapY);
@@ -48,6 +48,8 @@ bool gLoadSaveTitleSequenceSave = 0;
 uint8 gToolbarDirtyFlags;
 uint16 gWindowMapFlashingFlags;
 
+window_draw_stats gWindowDrawStats;
+
 // converted from uint16 values at 0x009A41EC - 0x009A4230
 // these are percentage coordinates of the viewport to center to, if a window is obscuring a location, the next is tried
 float window_scroll_locations[][2] = {
@@ -72,7 +74,8 @@ float window_scroll_locations[][2] = {
 
 static bool sub_6EA95D(int x, int y, int width, int height);
 static void window_all_wheel_input();
-static int window_draw_split(rct_window *w, int left, int top, int right, int bottom);
+static void window_draw_region(rct_window *w, rct_window *firstAbove, int left, int top, int right, int bottom);
+static int window_draw_split(rct_window *w, rct_window *firstAbove, int left, int top, int right, int bottom);
 
 int window_get_widget_index(rct_window *w, rct_widget *widget)
 {
@@ -171,6 +174,7 @@ void window_update_all()
 
 	RCT2_GLOBAL(0x009E3CD8, sint32)++;
 
+	sprite_flush_invalidations();
 	gfx_draw_all_dirty_blocks();
 	window_update_all_viewports();
 	gfx_draw_all_dirty_blocks();
@@ -1500,13 +1504,21 @@ void window_zoom_out(rct_window *w)
  * bottom (bp)
  */
 void window_draw(rct_window *w, int left, int top, int right, int bottom)
+{
+	window_draw_region(w, w + 1, left, top, right, bottom);
+}
+
+/**
+ * Draws a region of a window, windows between w and firstAbove are known not to overlap the region.
+ */
+static void window_draw_region(rct_window *w, rct_window *firstAbove, int left, int top, int right, int bottom)
 {
 	rct_window* v;
 	rct_drawpixelinfo *dpi, copy;
 	int overflow;
 
 	// Split window into only the regions that require drawing
-	if (window_draw_split(w, left, top, right, bottom))
+	if (window_draw_split(w, firstAbove, left, top, right, bottom))
 		return;
 
 	// Clamp region
@@ -1579,19 +1591,24 @@ void window_draw(rct_window *w, int left, int top, int right, int bottom)
 		RCT2_GLOBAL(RCT2_ADDRESS_CURRENT_WINDOW_COLOUR_4, uint8) = v->colours[3] & 0x7F;
 
 		window_event_paint_call(v, dpi);
+
+		gWindowDrawStats.painted += dpi->width * dpi->height;
+		gWindowDrawStats.regions++;
 	}
 }
 
 /**
  * Splits a drawing of a window into regions that can be seen and are not hidden
- * by other opaque overlapping windows.
+ * by other opaque overlapping windows. The split regions are within the original
+ * region so the search for overlapping windows resumes from the window that caused
+ * the split rather than starting again from w.
  */
-static int window_draw_split(rct_window *w, int left, int top, int right, int bottom)
+static int window_draw_split(rct_window *w, rct_window *firstAbove, int left, int top, int right, int bottom)
 {
 	rct_window* topwindow;
 
 	// Divide the draws up for only the visible regions of the window recursively
-	for (topwindow = w + 1; topwindow < RCT2_NEW_WINDOW; topwindow++) {
+	for (topwindow = firstAbove; topwindow < RCT2_NEW_WINDOW; topwindow++) {
 		// Check if this window overlaps w
 		if (topwindow->x >= right || topwindow->y >= bottom)
 			continue;
@@ -1603,20 +1620,20 @@ static int window_draw_split(rct_window *w, int left, int top, int right, int bo
 		// A window overlaps w, split up the draw into two regions where the window starts to overlap
 		if (topwindow->x > left) {
 			// Split draw at topwindow.left
-			window_draw(w, left, top, topwindow->x, bottom);
-			window_draw(w, topwindow->x, top, right, bottom);
+			window_draw_region(w, topwindow + 1, left, top, topwindow->x, bottom);
+			window_draw_region(w, topwindow, topwindow->x, top, right, bottom);
 		} else if (topwindow->x + topwindow->width < right) {
 			// Split draw at topwindow.right
-			window_draw(w, left, top, topwindow->x + topwindow->width, bottom);
-			window_draw(w, topwindow->x + topwindow->width, top, right, bottom);
+			window_draw_region(w, topwindow, left, top, topwindow->x + topwindow->width, bottom);
+			window_draw_region(w, topwindow + 1, topwindow->x + topwindow->width, top, right, bottom);
 		} else if (topwindow->y > top) {
 			// Split draw at topwindow.top
-			window_draw(w, left, top, right, topwindow->y);
-			window_draw(w, left, topwindow->y, right, bottom);
+			window_draw_region(w, topwindow + 1, left, top, right, topwindow->y);
+			window_draw_region(w, topwindow, left, topwindow->y, right, bottom);
 		} else if (topwindow->y + topwindow->height < bottom) {
 			// Split draw at topwindow.bottom
-			window_draw(w, left, top, right, topwindow->y + topwindow->height);
-			window_draw(w, left, topwindow->y + topwindow->height, right, bottom);
+			window_draw_region(w, topwindow, left, top, right, topwindow->y + topwindow->height);
+			window_draw_region(w, topwindow + 1, left, topwindow->y + topwindow->height, right, bottom);
 		}
 
 		// Drawing for this region should be done now, exit
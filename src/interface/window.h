@@ -514,6 +514,15 @@ extern ride_list_item _window_track_list_item;
 extern uint8 gToolbarDirtyFlags;
 extern uint16 gWindowMapFlashingFlags;
 
+typedef struct window_draw_stats {
+	uint64 visible;		// Pixels of dirty screen area redrawn
+	uint64 painted;		// Pixels painted by window paint events, including overdraw by transparent windows
+	uint32 regions;		// Number of regions window paint events were called for
+	uint32 skipped;		// Windows skipped because an opaque window above covers the whole dirty area
+} window_draw_stats;
+
+extern window_draw_stats gWindowDrawStats;
+
 void window_dispatch_update_all();
 void window_update_all_viewports();
 void window_update_all();
@@ -601,6 +610,8 @@ void window_staff_list_open();
 void window_guest_list_open();
 void window_guest_list_open_with_filter(int type, int index);
 void window_map_open();
+void window_map_invalidate_tile(int x, int y);
+void window_map_invalidate_all_tiles();
 void window_options_open();
 void window_shortcut_keys_open();
 void window_shortcut_change_open(int selected_key);
@@ -231,6 +231,7 @@ void language_close_all()
 	SafeDelete(_languageFallback);
 	SafeDelete(_languageCurrent);
 	gCurrentLanguage = LANGUAGE_UNDEFINED;
+	format_string_cache_invalidate();
 }
 
 #define STEX_BASE_STRING_ID			3447
@@ -328,6 +329,9 @@ rct_string_id object_get_localised_text(uint8_t** pStringTable/*ebp*/, int type/
 	int result = 0;
 	bool isBlank;
 
+	// The object's string ids are about to point at new text
+	format_string_cache_invalidate();
+
 	while ((languageId = *(*pStringTable)++) != RCT2_LANGUAGE_ID_END) {
 		isBlank = true;
 
@@ -606,6 +606,77 @@ void format_realtime(char **dest, uint16 value)
 	(*dest)--;
 }
 
+#pragma region Format string cache
+
+#define FORMAT_STRING_CACHE_SETS			256
+#define FORMAT_STRING_CACHE_WAYS			4
+#define FORMAT_STRING_CACHE_MAX_ARGS		32
+#define FORMAT_STRING_CACHE_MAX_HASHED_ARGS	16
+#define FORMAT_STRING_CACHE_MAX_LENGTH		128
+
+// Only arguments in the common format argument buffer are cached, other callers pass arbitrary sized locals that are
+// not safe to read ahead of formatting.
+#define FORMAT_STRING_CACHE_ARGS_BUFFER_SIZE	80
+
+typedef struct format_string_cache_entry {
+	uint32 generation;
+	rct_string_id format;
+	uint8 args_length;
+	uint8 length;
+	uint8 args[FORMAT_STRING_CACHE_MAX_ARGS];
+	utf8 text[FORMAT_STRING_CACHE_MAX_LENGTH];
+} format_string_cache_entry;
+
+static format_string_cache_entry _formatStringCache[FORMAT_STRING_CACHE_SETS][FORMAT_STRING_CACHE_WAYS];
+static uint8 _formatStringCacheNextWay[FORMAT_STRING_CACHE_SETS];
+
+// Number of argument bytes hashed for each string id plus one, zero until the string has been formatted once
+static uint8 _formatStringCacheHashLength[0x10000];
+
+static uint32 _formatStringCacheGeneration = 1;
+static uint8 _formatStringCacheCurrency;
+static uint8 _formatStringCacheMeasurement;
+static bool _formatStringCacheTrueType;
+
+static bool _formatStringUncacheable;
+
+format_string_cache_stats gFormatStringCacheStats;
+
+/**
+ * Drops every cached string, must be called whenever a language or object string changes.
+ */
+void format_string_cache_invalidate()
+{
+	_formatStringCacheGeneration++;
+	if (_formatStringCacheGeneration == 0)
+		_formatStringCacheGeneration++;
+}
+
+static uint32 format_string_cache_hash(rct_string_id format, const uint8 *args, int argsLength)
+{
+	uint32 hash = 2166136261 ^ format;
+	for (int i = 0; i < argsLength; i++) {
+		hash ^= args[i];
+		hash *= 16777619;
+	}
+	return (hash ^ (hash >> 16)) % FORMAT_STRING_CACHE_SETS;
+}
+
+static void format_string_cache_check_config()
+{
+	if (_formatStringCacheCurrency != gConfigGeneral.currency_format ||
+		_formatStringCacheMeasurement != gConfigGeneral.measurement_format ||
+		_formatStringCacheTrueType != gUseTrueTypeFont
+	) {
+		_formatStringCacheCurrency = gConfigGeneral.currency_format;
+		_formatStringCacheMeasurement = gConfigGeneral.measurement_format;
+		_formatStringCacheTrueType = gUseTrueTypeFont;
+		format_string_cache_invalidate();
+	}
+}
+
+#pragma endregion
+
 void format_string_code(unsigned int format_code, char **dest, char **args)
 {
 	int value;
@@ -681,6 +752,9 @@ void format_string_code(unsigned int format_code, char **dest, char **args)
 		value = *((uint32*)*args);
 		*args += 4;
 
+		// The text behind the pointer can change without the argument changing
+		_formatStringUncacheable = true;
+
 		if (value != 0) {
 			strcpy(*dest, (char*)value);
 			*dest += strlen(*dest);
@@ -713,6 +787,7 @@ void format_string_code(unsigned int format_code, char **dest, char **args)
 		break;
 	case FORMAT_PUSH16:
 		*args -= 2;
+		_formatStringUncacheable = true;
 		break;
 	case FORMAT_DURATION:
 		// Pop argument
@@ -792,6 +867,7 @@ void format_string_part(utf8 **dest, rct_string_id format, char **args)
 	} else if (format < 0x9000) {
 		// Custom string
 		format -= 0x8000;
+		_formatStringUncacheable = true;
 
 		// Bits 10, 11 represent number of bytes to pop off arguments
 		*args += (format & 0xC00) >> 9;
@@ -811,6 +887,7 @@ void format_string_part(utf8 **dest, rct_string_id format, char **args)
 		*args += 4;
 	} else {
 		// ?
+		_formatStringUncacheable = true;
 		log_error("Localisation CALLPROC reached. Please contact a dev");
 		assert(false);
 		RCT2_CALLPROC_EBPSAFE(RCT2_ADDRESS(0x0095AFB8, uint32)[format]);
@@ -826,7 +903,65 @@ void format_string_part(utf8 **dest, rct_string_id format, char **args)
  */
 void format_string(utf8 *dest, rct_string_id format, void *args)
 {
+	const uint8 *argsBuffer = RCT2_ADDRESS(RCT2_ADDRESS_COMMON_FORMAT_ARGS, uint8);
+	const uint8 *argsStart = (const uint8*)args;
+	if (format == STR_NONE || argsStart < argsBuffer || argsStart >= argsBuffer + FORMAT_STRING_CACHE_ARGS_BUFFER_SIZE) {
+		format_string_part(&dest, format, (char**)&args);
+		return;
+	}
+
+	format_string_cache_check_config();
+
+	// The number of bytes a string consumes is only known once it has been formatted, so the set is chosen from the
+	// shortest argument length seen for the string id and the whole argument run is compared on lookup.
+	int hashLength = _formatStringCacheHashLength[format] - 1;
+	int hashLimit = (int)(argsBuffer + FORMAT_STRING_CACHE_ARGS_BUFFER_SIZE - argsStart);
+	if (hashLength > hashLimit)
+		hashLength = hashLimit;
+	if (hashLength >= 0) {
+		uint32 set = format_string_cache_hash(format, argsStart, hashLength);
+		for (int i = 0; i < FORMAT_STRING_CACHE_WAYS; i++) {
+			format_string_cache_entry *entry = &_formatStringCache[set][i];
+			if (entry->generation == _formatStringCacheGeneration &&
+				entry->format == format &&
+				entry->args_length <= hashLimit &&
+				memcmp(entry->args, argsStart, entry->args_length) == 0
+			) {
+				memcpy(dest, entry->text, entry->length);
+				gFormatStringCacheStats.hits++;
+				return;
+			}
+		}
+	}
+
+	utf8 *destStart = dest;
+	_formatStringUncacheable = false;
 	format_string_part(&dest, format, (char**)&args);
+
+	int argsLength = (int)((const uint8*)args - argsStart);
+	int length = (int)(dest - destStart);
+	if (_formatStringUncacheable || argsLength < 0 || argsLength > FORMAT_STRING_CACHE_MAX_ARGS || length <= 0 || length > FORMAT_STRING_CACHE_MAX_LENGTH) {
+		gFormatStringCacheStats.uncacheable++;
+		return;
+	}
+	gFormatStringCacheStats.misses++;
+
+	int learntHashLength = min(argsLength, FORMAT_STRING_CACHE_MAX_HASHED_ARGS);
+	if (hashLength < 0 || learntHashLength < hashLength) {
+		_formatStringCacheHashLength[format] = learntHashLength + 1;
+		hashLength = learntHashLength;
+	}
+
+	uint32 set = format_string_cache_hash(format, argsStart, hashLength);
+	format_string_cache_entry *entry = &_formatStringCache[set][_formatStringCacheNextWay[set]];
+	_formatStringCacheNextWay[set] = (_formatStringCacheNextWay[set] + 1) % FORMAT_STRING_CACHE_WAYS;
+
+	entry->generation = _formatStringCacheGeneration;
+	entry->format = format;
+	entry->args_length = argsLength;
+	entry->length = length;
+	memcpy(entry->args, argsStart, argsLength);
+	memcpy(entry->text, destStart, length);
 }
 
 void format_string_raw(utf8 *dest, utf8 *src, void *args)
@@ -32,6 +32,7 @@ void utf8_remove_formatting(utf8* string);
 void format_string(char *dest, rct_string_id format, void *args);
 void format_string_raw(char *dest, char *src, void *args);
 void format_string_to_upper(char *dest, rct_string_id format, void *args);
+void format_string_cache_invalidate();
 void generate_string_file();
 void error_string_quit(int error, rct_string_id format);
 utf8 *get_string_end(const utf8 *text);
@@ -53,6 +54,14 @@ wchar_t encoding_convert_unicode_to_rct2(wchar_t unicode);
 wchar_t encoding_convert_gb2312_to_unicode(wchar_t gb2312);
 wchar_t encoding_convert_big5_to_unicode(wchar_t big5);
 
+typedef struct format_string_cache_stats {
+	uint32 hits;
+	uint32 misses;
+	uint32 uncacheable;
+} format_string_cache_stats;
+
+extern format_string_cache_stats gFormatStringCacheStats;
+
 #define MAX_USER_STRINGS 1024
 #define USER_STRING_MAX_LENGTH 32
 
@@ -64,7 +64,7 @@ extern "C" {
 // This define specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "8"
+#define NETWORK_STREAM_VERSION "9"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 #define NETWORK_DISCONNECT_REASON_BUFFER_SIZE 256
@@ -86,6 +86,7 @@ extern "C" {
 	#include <arpa/inet.h>
 	#include <netdb.h>
 	#include <netinet/tcp.h>
+	#include <poll.h>
 	#include <sys/socket.h>
 	#include <fcntl.h>
 	typedef int SOCKET;
@@ -230,6 +231,7 @@ public:
 	int ReadPacket();
 	void QueuePacket(std::unique_ptr<NetworkPacket> packet, bool front = false);
 	void SendQueuedPackets();
+	bool HasQueuedPackets() const;
 	bool SetTCPNoDelay(bool on);
 	bool SetNonBlocking(bool on);
 	static bool SetNonBlocking(SOCKET socket, bool on);
@@ -253,6 +255,27 @@ private:
 	uint32 last_packet_time;
 };
 
+// Map is checksummed in square regions so that a desync can be narrowed down
+// to the area of the park that diverged.
+#define NETWORK_CHECKSUM_REGION_SIZE 32
+#define NETWORK_CHECKSUM_REGIONS_PER_AXIS (256 / NETWORK_CHECKSUM_REGION_SIZE)
+#define NETWORK_CHECKSUM_NUM_REGIONS (NETWORK_CHECKSUM_REGIONS_PER_AXIS * NETWORK_CHECKSUM_REGIONS_PER_AXIS)
+
+class NetworkStateChecksum
+{
+public:
+	void Compute(uint32 tick);
+	void Read(NetworkPacket& packet);
+	void Write(NetworkPacket& packet);
+	bool Compare(const NetworkStateChecksum& other) const;
+	void LogDivergence(const NetworkStateChecksum& local) const;
+	uint32 tick = 0;
+	uint32 sprites = 0;
+	uint32 rides = 0;
+	uint32 finances = 0;
+	std::array<uint32, NETWORK_CHECKSUM_NUM_REGIONS> map_regions;
+};
+
 class NetworkAddress
 {
 public:
@@ -295,6 +318,7 @@ public:
 	uint32 GetServerTick();
 	uint8 GetPlayerID();
 	void Update();
+	void UpdateStateChecksum();
 	std::vector<std::unique_ptr<NetworkPlayer>>::iterator GetPlayerIteratorByID(uint8 id);
 	NetworkPlayer* GetPlayerByID(uint8 id);
 	std::vector<std::unique_ptr<NetworkGroup>>::iterator GetGroupIteratorByID(uint8 id);
@@ -302,6 +326,7 @@ public:
 	static const char* FormatChat(NetworkPlayer* fromplayer, const char* text);
 	void SendPacketToClients(NetworkPacket& packet, bool front = false);
 	bool CheckSRAND(uint32 tick, uint32 srand0);
+	bool CheckStateChecksum(uint32 tick);
 	void KickPlayer(int playerId);
 	void SetPassword(const char* password);
 	void ShutdownClient();
@@ -322,6 +347,7 @@ public:
 	void Client_Send_GAMECMD(uint32 eax, uint32 ebx, uint32 ecx, uint32 edx, uint32 esi, uint32 edi, uint32 ebp, uint8 callback);
 	void Server_Send_GAMECMD(uint32 eax, uint32 ebx, uint32 ecx, uint32 edx, uint32 esi, uint32 edi, uint32 ebp, uint8 playerid, uint8 callback);
 	void Server_Send_TICK();
+	void Server_Send_CHECKSUM();
 	void Server_Send_PLAYERLIST();
 	void Client_Send_PING();
 	void Server_Send_PING();
@@ -337,7 +363,7 @@ public:
 	std::vector<std::unique_ptr<NetworkGroup>> group_list;
 
 private:
-	bool ProcessConnection(NetworkConnection& connection);
+	bool ProcessConnection(NetworkConnection& connection, bool readable = true, bool writable = true);
 	void ProcessPacket(NetworkConnection& connection, NetworkPacket& packet);
 	void ProcessGameCommandQueue();
 	void AddClient(SOCKET socket);
@@ -371,8 +397,11 @@ private:
 	uint32 server_tick = 0;
 	uint32 server_srand0 = 0;
 	uint32 server_srand0_tick = 0;
+	NetworkStateChecksum server_checksum;
+	bool server_checksum_pending = false;
 	uint8 player_id = 0;
 	std::list<std::unique_ptr<NetworkConnection>> client_connection_list;
+	std::vector<pollfd> server_poll_fds;
 	std::multiset<GameCommand> game_command_queue;
 	std::vector<uint8> chunk_buffer;
 	std::string password;
@@ -387,6 +416,7 @@ private:
 
 	void UpdateServer();
 	void UpdateClient();
+	void SetDesynchronised();
 
 private:
 	std::vector<void (Network::*)(NetworkConnection& connection, NetworkPacket& packet)> client_command_handlers;
@@ -399,6 +429,7 @@ private:
 	void Client_Handle_GAMECMD(NetworkConnection& connection, NetworkPacket& packet);
 	void Server_Handle_GAMECMD(NetworkConnection& connection, NetworkPacket& packet);
 	void Client_Handle_TICK(NetworkConnection& connection, NetworkPacket& packet);
+	void Client_Handle_CHECKSUM(NetworkConnection& connection, NetworkPacket& packet);
 	void Client_Handle_PLAYERLIST(NetworkConnection& connection, NetworkPacket& packet);
 	void Client_Handle_PING(NetworkConnection& connection, NetworkPacket& packet);
 	void Server_Handle_PING(NetworkConnection& connection, NetworkPacket& packet);
@@ -427,6 +458,8 @@ int network_begin_server(int port);
 int network_get_mode();
 int network_get_status();
 void network_update();
+void network_update_state_checksum();
+uint32 network_get_state_checksum();
 int network_get_authstatus();
 uint32 network_get_server_tick();
 uint8 network_get_current_player_id();
@@ -101,6 +101,9 @@ extern uint32 gNumInstalledCustomObjects;
 
 extern void *gLastLoadedObjectChunkData;
 
+// When set, object_load_entries keeps objects already loaded in the slot they are requested in instead of reading them again
+extern bool gObjectKeepLoadedEntries;
+
 int object_load_entry(const utf8 *path, rct_object_entry *outEntry);
 void object_list_load();
 void set_load_objects_fail_reason();
@@ -542,24 +542,62 @@ bool object_read_and_load_entries(SDL_RWops* rw)
 	return result;
 }
 
+bool gObjectKeepLoadedEntries = false;
+
+/**
+ * Gets the object type and the index within its entry group of an index into the full list of object entries.
+ */
+static int object_entry_get_group_index(int entryIndex, int *outObjectType)
+{
+	int entryGroupIndex = entryIndex;
+	int objectType = 0;
+	for (; objectType < countof(object_entry_group_counts); objectType++) {
+		if (entryGroupIndex < object_entry_group_counts[objectType])
+			break;
+		entryGroupIndex -= object_entry_group_counts[objectType];
+	}
+	*outObjectType = objectType;
+	return entryGroupIndex;
+}
+
 bool object_load_entries(rct_object_entry* entries)
 {
 	log_verbose("loading required objects");
 
+	bool keepEntry[OBJECT_ENTRY_COUNT] = { false };
+	if (gObjectKeepLoadedEntries) {
+		// Keep the objects that are already loaded in the same slot and unload the others to make room
+		for (int i = 0; i < OBJECT_ENTRY_COUNT; i++) {
+			int objectType;
+			int entryGroupIndex = object_entry_get_group_index(i, &objectType);
+			rct_object_entry_group *entryGroup = &object_entry_groups[objectType];
+			uint8 *chunk = entryGroup->chunks[entryGroupIndex];
+			if (chunk == (uint8*)-1)
+				continue;
+
+			if (check_object_entry(&entries[i]) && object_entry_compare((rct_object_entry*)&entryGroup->entries[entryGroupIndex], &entries[i])) {
+				keepEntry[i] = true;
+				continue;
+			}
+			object_unload(objectType, chunk);
+			free(chunk);
+			entryGroup->chunks[entryGroupIndex] = (uint8*)-1;
+		}
+
+		// The images of the kept objects are laid out again so the new ones start after them rather than after the
+		// images of everything that was loaded before
+		reset_loaded_objects();
+	}
+
 	bool loadFailed = false;
 	// Load each object
 	for (int i = 0; i < OBJECT_ENTRY_COUNT; i++) {
-		if (!check_object_entry(&entries[i])) {
+		if (keepEntry[i] || !check_object_entry(&entries[i])) {
 			continue;
 		}
 
-		// Get entry group index
-		int entryGroupIndex = i;
-		for (int j = 0; j < countof(object_entry_group_counts); j++) {
-			if (entryGroupIndex < object_entry_group_counts[j])
-				break;
-			entryGroupIndex -= object_entry_group_counts[j];
-		}
+		int objectType;
+		int entryGroupIndex = object_entry_get_group_index(i, &objectType);
 
 		// Load the obect
 		if (!object_load_chunk(entryGroupIndex, &entries[i], NULL)) {
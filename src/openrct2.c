@@ -32,6 +32,7 @@
 #include "openrct2.h"
 #include "platform/crash.h"
 #include "platform/platform.h"
+#include "replay.h"
 #include "ride/ride.h"
 #include "title.h"
 #include "util/sawyercoding.h"
@@ -66,7 +67,14 @@ bool gOpenRCT2SilentBreakpad;
 int _finished;
 
 // Used for object movement tweening
-static struct { sint16 x, y, z; } _spritelocations1[MAX_SPRITES], _spritelocations2[MAX_SPRITES];
+typedef struct { sint16 x, y, z; } sprite_tween_location;
+static sprite_tween_location _spritelocations1[MAX_SPRITES], _spritelocations2[MAX_SPRITES];
+static uint32 _spritelocations1Stamp[MAX_SPRITES], _spritelocations2Stamp[MAX_SPRITES];
+static uint32 _currentTweenStamp = 1;
+
+// The real coordinates of the sprites drawn at a tweened position, restored after drawing
+static struct { uint16 sprite_index; sint16 x, y, z, left, top, right, bottom; } _tweenedSprites[MAX_SPRITES];
+static int _numTweenedSprites;
 
 static void openrct2_loop();
 static void openrct2_setup_rct2_hooks();
@@ -329,6 +337,7 @@ void openrct2_launch()
 
 void openrct2_dispose()
 {
+	replay_stop_recording();
 	network_close();
 	http_dispose();
 	language_close_all();
@@ -338,17 +347,96 @@ void openrct2_dispose()
 }
 
 /**
- * Determines whether its worth tweening a sprite or not when frame smoothing is on.
+ * The sprite lists whose sprites are worth tweening when frame smoothing is on.
  */
-static bool sprite_should_tween(rct_sprite *sprite)
+static const uint8 TweenSpriteLists[] = { SPRITE_LIST_VEHICLE, SPRITE_LIST_PEEP, SPRITE_LIST_UNKNOWN };
+
+static void openrct2_store_tween_locations(sprite_tween_location *locations, uint32 *stamps)
 {
-	switch (sprite->unknown.linked_list_type_offset >> 1) {
-	case SPRITE_LIST_VEHICLE:
-	case SPRITE_LIST_PEEP:
-	case SPRITE_LIST_UNKNOWN:
-		return true;
+	for (int i = 0; i < countof(TweenSpriteLists); i++) {
+		rct_sprite *sprite;
+		for (uint16 spriteIndex = gSpriteListHead[TweenSpriteLists[i]]; spriteIndex != SPRITE_INDEX_NULL; spriteIndex = sprite->unknown.next) {
+			sprite = &g_sprite_list[spriteIndex];
+			locations[spriteIndex].x = sprite->unknown.x;
+			locations[spriteIndex].y = sprite->unknown.y;
+			locations[spriteIndex].z = sprite->unknown.z;
+			stamps[spriteIndex] = _currentTweenStamp;
+		}
 	}
-	return false;
+}
+
+/**
+ * Moves the sprites that moved during the last tick to their position between the last and the next tick for drawing.
+ * Only the drawn coordinates change, the quadrant lists are left alone as the real positions are restored afterwards.
+ */
+static void openrct2_apply_tween_locations(float nudge)
+{
+	_numTweenedSprites = 0;
+	for (int i = 0; i < countof(TweenSpriteLists); i++) {
+		rct_sprite *sprite;
+		for (uint16 spriteIndex = gSpriteListHead[TweenSpriteLists[i]]; spriteIndex != SPRITE_INDEX_NULL; spriteIndex = sprite->unknown.next) {
+			sprite = &g_sprite_list[spriteIndex];
+
+			// Skip sprites that appeared during the tick or have been moved since
+			if (_spritelocations1Stamp[spriteIndex] != _currentTweenStamp)
+				continue;
+			if (_spritelocations2Stamp[spriteIndex] != _currentTweenStamp)
+				continue;
+
+			sprite_tween_location *from = &_spritelocations1[spriteIndex];
+			sprite_tween_location *to = &_spritelocations2[spriteIndex];
+			if (from->x == to->x && from->y == to->y && from->z == to->z)
+				continue;
+			if (from->x == SPRITE_LOCATION_NULL || to->x == SPRITE_LOCATION_NULL)
+				continue;
+			if (sprite->unknown.x != to->x || sprite->unknown.y != to->y || sprite->unknown.z != to->z)
+				continue;
+
+			_tweenedSprites[_numTweenedSprites].sprite_index = spriteIndex;
+			_tweenedSprites[_numTweenedSprites].x = sprite->unknown.x;
+			_tweenedSprites[_numTweenedSprites].y = sprite->unknown.y;
+			_tweenedSprites[_numTweenedSprites].z = sprite->unknown.z;
+			_tweenedSprites[_numTweenedSprites].left = sprite->unknown.sprite_left;
+			_tweenedSprites[_numTweenedSprites].top = sprite->unknown.sprite_top;
+			_tweenedSprites[_numTweenedSprites].right = sprite->unknown.sprite_right;
+			_tweenedSprites[_numTweenedSprites].bottom = sprite->unknown.sprite_bottom;
+			_numTweenedSprites++;
+
+			sprite_set_coordinates(
+				to->x + (sint16)((from->x - to->x) * nudge),
+				to->y + (sint16)((from->y - to->y) * nudge),
+				to->z + (sint16)((from->z - to->z) * nudge),
+				sprite
+			);
+			invalidate_sprite_2(sprite);
+		}
+	}
+}
+
+/**
+ * Restores the real coordinates of the sprites moved by openrct2_apply_tween_locations so that the game logic never
+ * sees a tweened position.
+ */
+static void openrct2_restore_tween_locations()
+{
+	for (int i = 0; i < _numTweenedSprites; i++) {
+		rct_sprite *sprite = &g_sprite_list[_tweenedSprites[i].sprite_index];
+
+		// Invalidate where it was drawn so that it is erased on the next frame
+		invalidate_sprite_2(sprite);
+
+		sprite->unknown.x = _tweenedSprites[i].x;
+		sprite->unknown.y = _tweenedSprites[i].y;
+		sprite->unknown.z = _tweenedSprites[i].z;
+		sprite->unknown.sprite_left = _tweenedSprites[i].left;
+		sprite->unknown.sprite_top = _tweenedSprites[i].top;
+		sprite->unknown.sprite_right = _tweenedSprites[i].right;
+		sprite->unknown.sprite_bottom = _tweenedSprites[i].bottom;
+
+		// Sprites that stop moving are not tweened next frame, so mark the real position dirty for it to be drawn whole
+		invalidate_sprite_2(sprite);
+	}
+	_numTweenedSprites = 0;
 }
 
 /**
@@ -382,21 +470,14 @@ static void openrct2_loop()
 
 			while (uncapTick <= currentTick && currentTick - uncapTick > 25) {
 				// Get the original position of each sprite
-				for (uint16 i = 0; i < MAX_SPRITES; i++) {
-					_spritelocations1[i].x = g_sprite_list[i].unknown.x;
-					_spritelocations1[i].y = g_sprite_list[i].unknown.y;
-					_spritelocations1[i].z = g_sprite_list[i].unknown.z;
-				}
+				_currentTweenStamp++;
+				openrct2_store_tween_locations(_spritelocations1, _spritelocations1Stamp);
 
 				// Update the game so the sprite positions update
 				rct2_update();
 
 				// Get the next position of each sprite
-				for (uint16 i = 0; i < MAX_SPRITES; i++) {
-					_spritelocations2[i].x = g_sprite_list[i].unknown.x;
-					_spritelocations2[i].y = g_sprite_list[i].unknown.y;
-					_spritelocations2[i].z = g_sprite_list[i].unknown.z;
-				}
+				openrct2_store_tween_locations(_spritelocations2, _spritelocations2Stamp);
 
 				uncapTick += 25;
 			}
@@ -404,18 +485,7 @@ static void openrct2_loop()
 			// Tween the position of each sprite from the last position to the new position based on the time between the last
 			// tick and the next tick.
 			float nudge = 1 - ((float)(currentTick - uncapTick) / 25);
-			for (uint16 i = 0; i < MAX_SPRITES; i++) {
-				if (!sprite_should_tween(&g_sprite_list[i]))
-					continue;
-
-				sprite_move(
-					_spritelocations2[i].x + (sint16)((_spritelocations1[i].x - _spritelocations2[i].x) * nudge),
-					_spritelocations2[i].y + (sint16)((_spritelocations1[i].y - _spritelocations2[i].y) * nudge),
-					_spritelocations2[i].z + (sint16)((_spritelocations1[i].z - _spritelocations2[i].z) * nudge),
-					&g_sprite_list[i]
-				);
-				invalidate_sprite_2(&g_sprite_list[i]);
-			}
+			openrct2_apply_tween_locations(nudge);
 
 			if ((SDL_GetWindowFlags(gWindow) & (SDL_WINDOW_MINIMIZED | SDL_WINDOW_HIDDEN)) == 0) {
 				rct2_draw();
@@ -429,13 +499,7 @@ static void openrct2_loop()
 			}
 
 			// Restore the real positions of the sprites so they aren't left at the mid-tween positions
-			for (uint16 i = 0; i < MAX_SPRITES; i++) {
-				if (!sprite_should_tween(&g_sprite_list[i]))
-					continue;
-
-				invalidate_sprite_2(&g_sprite_list[i]);
-				sprite_move(_spritelocations2[i].x, _spritelocations2[i].y, _spritelocations2[i].z, &g_sprite_list[i]);
-			}
+			openrct2_restore_tween_locations();
 			network_update();
 		} else {
 			uncapTick = 0;
@@ -471,11 +535,8 @@ void openrct2_finish()
 
 void openrct2_reset_object_tween_locations()
 {
-	for (uint16 i = 0; i < MAX_SPRITES; i++) {
-		_spritelocations1[i].x = _spritelocations2[i].x = g_sprite_list[i].unknown.x;
-		_spritelocations1[i].y = _spritelocations2[i].y = g_sprite_list[i].unknown.y;
-		_spritelocations1[i].z = _spritelocations2[i].z = g_sprite_list[i].unknown.z;
-	}
+	// Forget the stored locations, sprites are not tweened again until the next tick has been stored
+	_currentTweenStamp++;
 }
 
 /**
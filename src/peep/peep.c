@@ -1302,9 +1302,7 @@ void peep_sprite_remove(rct_peep* peep){
 		window_invalidate_by_class(WC_STAFF_LIST);
 
 		RCT2_ADDRESS(RCT2_ADDRESS_STAFF_MODE_ARRAY, uint8)[peep->staff_id] = 0;
-		peep->type = 0xFF;
-		staff_update_greyed_patrol_areas();
-		peep->type = PEEP_TYPE_STAFF;
+		staff_remove_from_greyed_patrol_areas(peep);
 
 		news_item_disable_news(NEWS_ITEM_PEEP, peep->sprite_index);
 	}
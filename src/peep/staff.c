@@ -31,6 +31,18 @@
 uint32 *gStaffPatrolAreas = (uint32*)RCT2_ADDRESS_STAFF_PATROL_AREAS;
 uint8 *gStaffModes = (uint8*)RCT2_ADDRESS_STAFF_MODE_ARRAY;
 
+// Sprite indices of all mechanics in peep list order, so mechanic searches do not have to walk every guest
+static uint16 _staffMechanics[STAFF_MAX_COUNT];
+static int _staffMechanicCount = 0;
+static bool _staffMechanicsValid = false;
+
+// Number of staff of each type patrolling each patrol quad, the greyed patrol area of a type is the quads with a
+// non-zero count. Rebuilt with staff_update_greyed_patrol_areas when not valid.
+static uint8 _staffPatrolQuadCounts[STAFF_TYPE_COUNT][64 * 64];
+static bool _staffPatrolQuadCountsValid = false;
+
+static void staff_update_greyed_patrol_quad(int staffType, int patrolIndex, int delta);
+
 /**
  *
  *  rct2: 0x006BD3A4
@@ -176,6 +188,7 @@ void game_command_hire_new_staff_member(int* eax, int* ebx, int* ecx, int* edx,
 
 		newPeep->id = newStaffIndex;
 		newPeep->staff_type = staff_type;
+		staff_invalidate_mechanic_list();
 
 		_eax = RCT2_ADDRESS(0x009929FC, uint8)[staff_type];
 		newPeep->name_string_idx = staff_type + 0x300;
@@ -354,6 +367,13 @@ void game_command_set_staff_patrol(int *eax, int *ebx, int *ecx, int *edx, int *
 		uint32 *patrolBits = (uint32*)(RCT2_ADDRESS_STAFF_PATROL_AREAS + patrolOffset + (base * 4));
 		*patrolBits ^= mask;
 
+		// Only the toggled quad of the greyed patrol area can change
+		if (_staffPatrolQuadCountsValid && peep->staff_type < STAFF_TYPE_COUNT) {
+			staff_update_greyed_patrol_quad(peep->staff_type, patrolIndex, (*patrolBits & mask) ? 1 : -1);
+		} else {
+			staff_update_greyed_patrol_areas();
+		}
+
 		int ispatrolling = 0;
 		for(int i = 0; i < 128; i++){
 			ispatrolling |= *(uint32*)(RCT2_ADDRESS_STAFF_PATROL_AREAS + patrolOffset + (i * 4));
@@ -369,7 +389,6 @@ void game_command_set_staff_patrol(int *eax, int *ebx, int *ecx, int *edx, int *
 				map_invalidate_tile_full((x & 0x1F80) + (x2 * 32), (y & 0x1F80) + (y2 * 32));
 			}
 		}
-		staff_update_greyed_patrol_areas();
 	}
 	*ebx = 0;
 }
@@ -444,19 +463,99 @@ void staff_update_greyed_patrol_areas()
 	{
 		for (int i = 0; i < 128; ++i)
 			RCT2_ADDRESS(RCT2_ADDRESS_STAFF_PATROL_AREAS + ((staff_type + STAFF_MAX_COUNT) * 512), uint32)[i] = 0;
+	}
+	memset(_staffPatrolQuadCounts, 0, sizeof(_staffPatrolQuadCounts));
 
-		for (uint16 sprite_index = gSpriteListHead[SPRITE_LIST_PEEP]; sprite_index != SPRITE_INDEX_NULL; sprite_index = peep->next)
+	// One pass over the peeps for all staff types
+	for (uint16 sprite_index = gSpriteListHead[SPRITE_LIST_PEEP]; sprite_index != SPRITE_INDEX_NULL; sprite_index = peep->next)
+	{
+		peep = GET_PEEP(sprite_index);
+
+		if (peep->type == PEEP_TYPE_STAFF && peep->staff_type < STAFF_TYPE_COUNT)
 		{
-			peep = GET_PEEP(sprite_index);
+			uint32 *patrolBits = RCT2_ADDRESS(RCT2_ADDRESS_STAFF_PATROL_AREAS + (peep->staff_id * 512), uint32);
+			uint32 *greyedBits = RCT2_ADDRESS(RCT2_ADDRESS_STAFF_PATROL_AREAS + ((peep->staff_type + STAFF_MAX_COUNT) * 512), uint32);
+			for (int i = 0; i < 128; ++i) {
+				greyedBits[i] |= patrolBits[i];
+				for (uint32 bits = patrolBits[i]; bits != 0; bits &= bits - 1)
+					_staffPatrolQuadCounts[peep->staff_type][i * 32 + bitscanforward(bits)]++;
+			}
+		}
+	}
+	_staffPatrolQuadCountsValid = true;
+}
 
-			if (peep->type == PEEP_TYPE_STAFF && staff_type == peep->staff_type)
-			{
-				for (int i = 0; i < 128; ++i)
-					RCT2_ADDRESS(RCT2_ADDRESS_STAFF_PATROL_AREAS + ((staff_type + STAFF_MAX_COUNT) * 512), uint32)[i] |= RCT2_ADDRESS(RCT2_ADDRESS_STAFF_PATROL_AREAS + (peep->staff_id * 512), uint32)[i];
+/**
+ * Marks the per quad patrol counts as out of date, called when the patrol areas or staff are replaced (e.g. on load).
+ */
+void staff_invalidate_greyed_patrol_areas()
+{
+	_staffPatrolQuadCountsValid = false;
+}
 
-			}
+static void staff_update_greyed_patrol_quad(int staffType, int patrolIndex, int delta)
+{
+	uint8 *count = &_staffPatrolQuadCounts[staffType][patrolIndex];
+	*count += delta;
+
+	uint32 *greyedBits = RCT2_ADDRESS(RCT2_ADDRESS_STAFF_PATROL_AREAS + ((staffType + STAFF_MAX_COUNT) * 512), uint32);
+	if (*count == 0)
+		greyedBits[patrolIndex >> 5] &= ~(1u << (patrolIndex & 0x1F));
+	else
+		greyedBits[patrolIndex >> 5] |= 1u << (patrolIndex & 0x1F);
+}
+
+/**
+ * Removes a staff member's patrol area from the greyed patrol area of its type, call before the staff member's
+ * patrol area is cleared or it is removed from the park.
+ */
+void staff_remove_from_greyed_patrol_areas(rct_peep *staff)
+{
+	if (!_staffPatrolQuadCountsValid || staff->staff_type >= STAFF_TYPE_COUNT) {
+		uint8 type = staff->type;
+		staff->type = 0xFF;
+		staff_update_greyed_patrol_areas();
+		staff->type = type;
+		return;
+	}
+
+	uint32 *patrolBits = RCT2_ADDRESS(RCT2_ADDRESS_STAFF_PATROL_AREAS + (staff->staff_id * 512), uint32);
+	for (int i = 0; i < 128; ++i) {
+		for (uint32 bits = patrolBits[i]; bits != 0; bits &= bits - 1)
+			staff_update_greyed_patrol_quad(staff->staff_type, i * 32 + bitscanforward(bits), -1);
+	}
+}
+
+/**
+ * Marks the list of mechanics as out of date, called whenever staff join or leave the peep list.
+ */
+void staff_invalidate_mechanic_list()
+{
+	_staffMechanicsValid = false;
+}
+
+/**
+ * Gets the sprite indices of all mechanics, in the order FOR_ALL_STAFF would visit them.
+ */
+int staff_get_mechanics(const uint16 **outSpriteIndices)
+{
+	if (!_staffMechanicsValid) {
+		uint16 spriteIndex;
+		rct_peep *peep;
+
+		_staffMechanicCount = 0;
+		FOR_ALL_STAFF(spriteIndex, peep) {
+			if (peep->staff_type != STAFF_TYPE_MECHANIC)
+				continue;
+			if (_staffMechanicCount >= STAFF_MAX_COUNT)
+				break;
+			_staffMechanics[_staffMechanicCount++] = spriteIndex;
 		}
+		_staffMechanicsValid = true;
 	}
+
+	*outSpriteIndices = _staffMechanics;
+	return _staffMechanicCount;
 }
 
 static int staff_is_location_in_patrol_area(rct_peep *peep, int x, int y)
@@ -64,7 +64,11 @@ void staff_reset_modes();
 void update_staff_colour(uint8 staffType, uint16 colour);
 uint16 hire_new_staff_member(uint8 staffType);
 void staff_update_greyed_patrol_areas();
+void staff_invalidate_greyed_patrol_areas();
+void staff_remove_from_greyed_patrol_areas(rct_peep *staff);
 int staff_is_location_in_patrol(rct_peep *mechanic, int x, int y);
+void staff_invalidate_mechanic_list();
+int staff_get_mechanics(const uint16 **outSpriteIndices);
 int staff_path_finding(rct_peep* peep);
 void staff_reset_stats();
 bool staff_is_patrol_area_set(int staffIndex, int x, int y);
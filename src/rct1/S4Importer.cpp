@@ -1117,6 +1117,9 @@ void S4Importer::ClearExtraTileEntries()
     }
 
     gNextFreeMapElement = nextFreeMapElement;
+    map_invalidate_all_tile_element_types();
+    ride_track_registry_invalidate();
+    park_invalidate_statistics();
 }
 
 void S4Importer::FixColours()
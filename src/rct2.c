@@ -48,6 +48,7 @@
 #include "world/map.h"
 #include "world/park.h"
 #include "world/climate.h"
+#include "world/footpath.h"
 #include "world/scenery.h"
 #include "world/sprite.h"
 
@@ -134,6 +135,7 @@ void rct2_dispose()
 	gfx_unload_g2();
 	gfx_unload_g1();
 	object_unload_all();
+	footpath_dispose();
 }
 
 int rct2_init()
@@ -298,6 +300,7 @@ void rct2_draw()
 		rct2_draw_fps();
 	}
 
+	sprite_invalidation_stats_end_frame();
 	gCurrentDrawCount++;
 }
 
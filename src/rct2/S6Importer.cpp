@@ -345,6 +345,7 @@ void S6Importer::Import()
     gNextGuestNumber = _s6.next_guest_index;
     gGrassSceneryTileLoopPosition = _s6.grass_and_scenery_tilepos;
     memcpy(gStaffPatrolAreas, _s6.patrol_areas, sizeof(_s6.patrol_areas));
+    staff_invalidate_greyed_patrol_areas();
     memcpy(gStaffModes, _s6.staff_modes, sizeof(_s6.staff_modes));
     // unk_13CA73E
     // pad_13CA73F
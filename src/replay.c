@@ -0,0 +1,329 @@
+#pragma region Copyright (c) 2014-2016 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#include "game.h"
+#include "network/network.h"
+#include "openrct2.h"
+#include "platform/platform.h"
+#include "replay.h"
+#include "scenario.h"
+#include "util/util.h"
+
+/**
+ * A recording is the park as sent to network clients followed by a stream of records, each stamped with the tick it
+ * happened on. Commands are stored as the registers they were applied with, the same form the network sends them in.
+ */
+#define REPLAY_MAGIC 0x594C5052 // RPLY
+#define REPLAY_VERSION 1
+
+enum {
+	REPLAY_RECORD_END,
+	REPLAY_RECORD_COMMAND,
+	REPLAY_RECORD_CHECKSUM,
+};
+
+typedef struct replay_record {
+	uint8 type;
+	uint32 tick;
+	uint32 checksum;
+	uint32 registers[7]; // eax, ebx, ecx, edx, esi, edi, ebp
+} replay_record;
+
+static SDL_RWops *_replayRecordFile = NULL;
+static uint32 _replayRecordStartTick;
+static uint32 _replayRecordNumCommands;
+
+static void replay_write_record(SDL_RWops *rw, const replay_record *record)
+{
+	SDL_WriteU8(rw, record->type);
+	SDL_WriteLE32(rw, record->tick);
+	if (record->type == REPLAY_RECORD_COMMAND) {
+		for (int i = 0; i < countof(record->registers); i++)
+			SDL_WriteLE32(rw, record->registers[i]);
+	} else {
+		SDL_WriteLE32(rw, record->checksum);
+	}
+}
+
+static bool replay_read_record(SDL_RWops *rw, replay_record *record)
+{
+	if (SDL_RWread(rw, &record->type, sizeof(uint8), 1) != 1)
+		return false;
+
+	record->tick = SDL_ReadLE32(rw);
+	switch (record->type) {
+	case REPLAY_RECORD_COMMAND:
+		for (int i = 0; i < countof(record->registers); i++)
+			record->registers[i] = SDL_ReadLE32(rw);
+		return true;
+	case REPLAY_RECORD_END:
+	case REPLAY_RECORD_CHECKSUM:
+		record->checksum = SDL_ReadLE32(rw);
+		return true;
+	default:
+		log_error("Unknown replay record type %d.", record->type);
+		return false;
+	}
+}
+
+/**
+ * Saves the park the same way the server does for joining clients and returns it as a buffer that must be freed.
+ */
+static uint8 *replay_save_park(size_t *outSize)
+{
+	FILE *temp = tmpfile();
+	if (temp == NULL) {
+		log_error("Failed to create temporary file to save park.");
+		return NULL;
+	}
+
+	SDL_RWops *rw = SDL_RWFromFP(temp, SDL_TRUE);
+	bool rleState = gUseRLE;
+	gUseRLE = false;
+	int saved = scenario_save_network(rw);
+	gUseRLE = rleState;
+
+	uint8 *buffer = NULL;
+	size_t size = (size_t)SDL_RWtell(rw);
+	if (saved && size > 0) {
+		buffer = malloc(size);
+		SDL_RWseek(rw, 0, RW_SEEK_SET);
+		if (SDL_RWread(rw, buffer, size, 1) != 1) {
+			SafeFree(buffer);
+		}
+	}
+	SDL_RWclose(rw);
+
+	*outSize = size;
+	return buffer;
+}
+
+bool replay_is_recording()
+{
+	return _replayRecordFile != NULL;
+}
+
+/**
+ * Starts recording the current park and all game commands applied to it from now on to the given file.
+ */
+bool replay_start_recording(const utf8 *path)
+{
+	replay_stop_recording();
+
+	size_t parkSize;
+	uint8 *park = replay_save_park(&parkSize);
+	if (park == NULL) {
+		log_error("Unable to save the park for recording.");
+		return false;
+	}
+
+	SDL_RWops *rw = SDL_RWFromFile(path, "wb");
+	if (rw == NULL) {
+		log_error("Unable to open %s for writing.", path);
+		free(park);
+		return false;
+	}
+
+	SDL_WriteLE32(rw, REPLAY_MAGIC);
+	SDL_WriteLE16(rw, REPLAY_VERSION);
+	SDL_WriteLE32(rw, gCurrentTicks);
+	SDL_WriteLE32(rw, (uint32)parkSize);
+	SDL_RWwrite(rw, park, parkSize, 1);
+	free(park);
+
+	_replayRecordFile = rw;
+	_replayRecordStartTick = gCurrentTicks;
+	_replayRecordNumCommands = 0;
+	log_verbose("recording replay to %s", path);
+	return true;
+}
+
+/**
+ * Ends the recording with the final state checksum so playback can confirm it arrived at the same park.
+ */
+void replay_stop_recording()
+{
+	if (_replayRecordFile == NULL)
+		return;
+
+	replay_record record = { 0 };
+	record.type = REPLAY_RECORD_END;
+	record.tick = gCurrentTicks;
+	record.checksum = network_get_state_checksum();
+	replay_write_record(_replayRecordFile, &record);
+
+	SDL_RWclose(_replayRecordFile);
+	_replayRecordFile = NULL;
+	log_verbose("recorded %u ticks and %u game commands", gCurrentTicks - _replayRecordStartTick, _replayRecordNumCommands);
+}
+
+/**
+ * Called by game_do_command_p just before a top level command is applied.
+ */
+void replay_record_command(int eax, int ebx, int ecx, int edx, int esi, int edi, int ebp)
+{
+	if (_replayRecordFile == NULL)
+		return;
+
+	replay_record record = { 0 };
+	record.type = REPLAY_RECORD_COMMAND;
+	record.tick = gCurrentTicks;
+	record.registers[0] = eax;
+	record.registers[1] = ebx;
+	record.registers[2] = ecx;
+	record.registers[3] = edx;
+	record.registers[4] = esi;
+	record.registers[5] = edi;
+	record.registers[6] = ebp;
+	replay_write_record(_replayRecordFile, &record);
+	_replayRecordNumCommands++;
+}
+
+/**
+ * Called once per game tick once every command for the tick has run, at the same point the network compares states.
+ */
+void replay_update()
+{
+	if (_replayRecordFile == NULL)
+		return;
+
+	if (gCurrentTicks % REPLAY_CHECKSUM_INTERVAL == 0) {
+		replay_record record = { 0 };
+		record.type = REPLAY_RECORD_CHECKSUM;
+		record.tick = gCurrentTicks;
+		record.checksum = network_get_state_checksum();
+		replay_write_record(_replayRecordFile, &record);
+	}
+}
+
+static bool replay_load_park(SDL_RWops *rw, uint32 *outStartTick)
+{
+	uint32 magic = SDL_ReadLE32(rw);
+	uint16 version = SDL_ReadLE16(rw);
+	uint32 startTick = SDL_ReadLE32(rw);
+	uint32 parkSize = SDL_ReadLE32(rw);
+	if (magic != REPLAY_MAGIC || version != REPLAY_VERSION || parkSize == 0) {
+		log_error("Not a replay or unsupported replay version.");
+		return false;
+	}
+
+	uint8 *park = malloc(parkSize);
+	if (park == NULL || SDL_RWread(rw, park, parkSize, 1) != 1) {
+		log_error("Replay is truncated.");
+		SafeFree(park);
+		return false;
+	}
+
+	SDL_RWops *parkRW = SDL_RWFromMem(park, parkSize);
+	int loaded = game_load_network(parkRW);
+	SDL_RWclose(parkRW);
+	free(park);
+	if (!loaded) {
+		log_error("Unable to load the recorded park.");
+		return false;
+	}
+
+	game_load_init();
+	if (gCurrentTicks != startTick) {
+		log_warning("Recorded park starts at tick %u, expected %u.", gCurrentTicks, startTick);
+	}
+	*outStartTick = gCurrentTicks;
+	return true;
+}
+
+/**
+ * Loads a recording and runs it as fast as possible without drawing. Commands are applied at the tick they were
+ * recorded on before the tick is simulated, matching how the network applies queued commands. Returns false if the
+ * recording could not be read or the park diverged from the recorded state checksums.
+ */
+bool replay_play(const utf8 *path)
+{
+	SDL_RWops *rw = SDL_RWFromFile(path, "rb");
+	if (rw == NULL) {
+		log_error("Unable to open %s.", path);
+		return false;
+	}
+
+	uint32 startTick;
+	if (!replay_load_park(rw, &startTick)) {
+		SDL_RWclose(rw);
+		return false;
+	}
+
+	uint32 numCommands = 0;
+	uint32 numChecksums = 0;
+	uint32 numMismatches = 0;
+	uint32 firstMismatchTick = 0;
+	bool ended = false;
+	uint32 startTime = platform_get_ticks();
+
+	replay_record record;
+	while (!ended && replay_read_record(rw, &record)) {
+		while (gCurrentTicks < record.tick)
+			game_logic_update();
+
+		if (record.tick != gCurrentTicks) {
+			log_error("Replay record for tick %u is out of order.", record.tick);
+			break;
+		}
+
+		if (record.type == REPLAY_RECORD_COMMAND) {
+			int eax = record.registers[0];
+			int ebx = record.registers[1];
+			int ecx = record.registers[2];
+			int edx = record.registers[3];
+			int esi = record.registers[4];
+			int edi = record.registers[5];
+			int ebp = record.registers[6];
+			game_do_command_p(esi, &eax, &ebx, &ecx, &edx, &esi, &edi, &ebp);
+			numCommands++;
+		} else {
+			if (network_get_state_checksum() != record.checksum) {
+				if (numMismatches == 0)
+					firstMismatchTick = record.tick;
+				numMismatches++;
+			}
+			numChecksums++;
+			ended = record.type == REPLAY_RECORD_END;
+		}
+	}
+	SDL_RWclose(rw);
+
+	uint32 elapsed = platform_get_ticks() - startTime;
+	uint32 numTicks = gCurrentTicks - startTick;
+	printf("Replayed %u ticks and %u game commands in %u ms", numTicks, numCommands, elapsed);
+	if (elapsed > 0)
+		printf(" (%.1f ticks per second)", numTicks * 1000.0 / elapsed);
+	printf("\n");
+	printf("%u of %u state checksums matched\n", numChecksums - numMismatches, numChecksums);
+	if (numMismatches > 0)
+		printf("Park diverged from the recording at tick %u\n", firstMismatchTick);
+	if (!ended)
+		log_warning("Replay has no end record, the recording may be incomplete.");
+
+	return numMismatches == 0;
+}
+
+int cmdline_for_replay(const char *path)
+{
+	bool success = false;
+	gOpenRCT2Headless = true;
+	if (openrct2_initialise()) {
+		success = replay_play(path);
+	}
+	openrct2_dispose();
+	return success ? 1 : -1;
+}
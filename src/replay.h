@@ -0,0 +1,34 @@
+#pragma region Copyright (c) 2014-2016 OpenRCT2 Developers
+/*****************************************************************************
+ * OpenRCT2, an open source clone of Roller Coaster Tycoon 2.
+ *
+ * OpenRCT2 is the work of many authors, a full list can be found in contributors.md
+ * For more information, visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * A full copy of the GNU General Public License can be found in licence.txt
+ *****************************************************************************/
+#pragma endregion
+
+#ifndef _REPLAY_H_
+#define _REPLAY_H_
+
+#include "common.h"
+
+// Number of game ticks between state checksums written to a recording
+#define REPLAY_CHECKSUM_INTERVAL 40
+
+bool replay_is_recording();
+bool replay_start_recording(const utf8 *path);
+void replay_stop_recording();
+void replay_record_command(int eax, int ebx, int ecx, int edx, int esi, int edi, int ebp);
+void replay_update();
+
+bool replay_play(const utf8 *path);
+int cmdline_for_replay(const char *path);
+
+#endif
@@ -384,6 +384,145 @@ money32 ride_calculate_income_per_hour(rct_ride *ride)
 	return customersPerHour * priceMinusCost;
 }
 
+// Tiles that may hold track elements of each ride so track lookups scan the ride rather than the whole map. Tiles are
+// added when track is placed, and tiles left without the ride's track are dropped when the list is next read.
+typedef struct ride_track_tiles {
+	rct_xy8 *tiles;
+	int count;
+	int capacity;
+	bool unsorted;
+} ride_track_tiles;
+
+static ride_track_tiles _rideTrackTiles[MAX_RIDES];
+static bool _rideTrackTilesValid = false;
+
+/**
+ * Gets the first track element of a ride on a tile, or NULL if the tile has none.
+ * @param x x tile.
+ * @param y y tile.
+ */
+static rct_map_element *ride_get_first_track_element_on_tile(int rideIndex, int x, int y)
+{
+	rct_map_element *mapElement = map_get_first_element_at(x, y);
+	do {
+		if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK)
+			continue;
+		if (mapElement->properties.track.ride_index == rideIndex)
+			return mapElement;
+	} while (!map_element_is_last_for_tile(mapElement++));
+	return NULL;
+}
+
+static bool ride_tile_has_track(int rideIndex, int x, int y)
+{
+	return ride_get_first_track_element_on_tile(rideIndex, x, y) != NULL;
+}
+
+static void ride_track_tiles_append(ride_track_tiles *list, int x, int y)
+{
+	if (list->count > 0) {
+		rct_xy8 last = list->tiles[list->count - 1];
+		if (last.x == x && last.y == y)
+			return;
+		if (last.xy > (uint16)(x | (y << 8)))
+			list->unsorted = true;
+	}
+
+	if (list->count >= list->capacity) {
+		list->capacity = max(32, list->capacity * 2);
+		list->tiles = realloc(list->tiles, list->capacity * sizeof(rct_xy8));
+	}
+	list->tiles[list->count].x = x;
+	list->tiles[list->count].y = y;
+	list->count++;
+}
+
+static int ride_track_tiles_compare(const void *a, const void *b)
+{
+	return (int)((const rct_xy8*)a)->xy - (int)((const rct_xy8*)b)->xy;
+}
+
+/**
+ * Marks the registry as out of date, it is rebuilt from the map the next time it is read. Called whenever the map is
+ * replaced as a whole, e.g. when a park is loaded.
+ */
+void ride_track_registry_invalidate()
+{
+	_rideTrackTilesValid = false;
+}
+
+static void ride_track_registry_rebuild()
+{
+	for (int i = 0; i < MAX_RIDES; i++)
+		_rideTrackTiles[i].count = 0;
+
+	// Same order as map_element_iterator so the tile lists come out sorted
+	for (int y = 0; y < 256; y++) {
+		for (int x = 0; x < 256; x++) {
+			rct_map_element *mapElement = map_get_first_element_at(x, y);
+			do {
+				if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK)
+					continue;
+				if (mapElement->properties.track.ride_index >= MAX_RIDES)
+					continue;
+				ride_track_tiles_append(&_rideTrackTiles[mapElement->properties.track.ride_index], x, y);
+			} while (!map_element_is_last_for_tile(mapElement++));
+		}
+	}
+
+	for (int i = 0; i < MAX_RIDES; i++)
+		_rideTrackTiles[i].unsorted = false;
+	_rideTrackTilesValid = true;
+}
+
+/**
+ * Called whenever a track element is placed.
+ * @param x x tile.
+ * @param y y tile.
+ */
+void ride_track_registry_add(int rideIndex, int x, int y)
+{
+	if (!_rideTrackTilesValid || rideIndex < 0 || rideIndex >= MAX_RIDES)
+		return;
+
+	ride_track_tiles_append(&_rideTrackTiles[rideIndex], x, y);
+}
+
+/**
+ * Gets the tiles holding track elements of a ride, in the same order map_element_iterator would visit them.
+ * The list is only valid until the next track element is placed.
+ */
+int ride_get_track_tiles(int rideIndex, const rct_xy8 **outTiles)
+{
+	if (rideIndex < 0 || rideIndex >= MAX_RIDES) {
+		*outTiles = NULL;
+		return 0;
+	}
+	if (!_rideTrackTilesValid)
+		ride_track_registry_rebuild();
+
+	ride_track_tiles *list = &_rideTrackTiles[rideIndex];
+	if (list->unsorted) {
+		qsort(list->tiles, list->count, sizeof(rct_xy8), ride_track_tiles_compare);
+		list->unsorted = false;
+	}
+
+	// Drop duplicates and tiles whose track has since been removed
+	int count = 0;
+	for (int i = 0; i < list->count; i++) {
+		rct_xy8 tile = list->tiles[i];
+		if (count > 0 && list->tiles[count - 1].xy == tile.xy)
+			continue;
+		if (!ride_tile_has_track(rideIndex, tile.x, tile.y))
+			continue;
+		list->tiles[count++] = tile;
+	}
+	list->count = count;
+
+	*outTiles = list->tiles;
+	return count;
+}
+
 /**
  *
  *  rct2: 0x006CAF80
@@ -396,38 +535,41 @@ bool ride_try_get_origin_element(int rideIndex, rct_xy_element *output)
 {
 	rct_map_element *resultMapElement = NULL;
 
-	map_element_iterator it;
-	map_element_iterator_begin(&it);
-	do {
-		if (map_element_get_type(it.element) != MAP_ELEMENT_TYPE_TRACK)
-			continue;
-		if (rideIndex != it.element->properties.track.ride_index)
-			continue;
+	const rct_xy8 *tiles;
+	int numTiles = ride_get_track_tiles(rideIndex, &tiles);
+	for (int i = 0; i < numTiles; i++) {
+		rct_map_element *mapElement = map_get_first_element_at(tiles[i].x, tiles[i].y);
+		do {
+			if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK)
+				continue;
+			if (rideIndex != mapElement->properties.track.ride_index)
+				continue;
 
-		// Found a track piece for target ride
+			// Found a track piece for target ride
 
-		// Check if its not the station or ??? (but allow end piece of station)
-		bool specialTrackPiece = (
-			it.element->properties.track.type != TRACK_ELEM_BEGIN_STATION &&
-			it.element->properties.track.type != TRACK_ELEM_MIDDLE_STATION &&
-			(RCT2_ADDRESS(0x0099BA64, uint8)[it.element->properties.track.type * 16] & 0x10)
-		);
+			// Check if its not the station or ??? (but allow end piece of station)
+			bool specialTrackPiece = (
+				mapElement->properties.track.type != TRACK_ELEM_BEGIN_STATION &&
+				mapElement->properties.track.type != TRACK_ELEM_MIDDLE_STATION &&
+				(RCT2_ADDRESS(0x0099BA64, uint8)[mapElement->properties.track.type * 16] & 0x10)
+			);
 
-		// Set result tile to this track piece if first found track or a ???
-		if (resultMapElement == NULL || specialTrackPiece) {
-			resultMapElement = it.element;
+			// Set result tile to this track piece if first found track or a ???
+			if (resultMapElement == NULL || specialTrackPiece) {
+				resultMapElement = mapElement;
 
-			if (output != NULL) {
-				output->element = resultMapElement;
-				output->x = it.x * 32;
-				output->y = it.y * 32;
+				if (output != NULL) {
+					output->element = resultMapElement;
+					output->x = tiles[i].x * 32;
+					output->y = tiles[i].y * 32;
+				}
 			}
-		}
 
-		if (specialTrackPiece) {
-			return true;
-		}
-	} while (map_element_iterator_next(&it));
+			if (specialTrackPiece) {
+				return true;
+			}
+		} while (!map_element_is_last_for_tile(mapElement++));
+	}
 
 	return resultMapElement != NULL;
 }
@@ -854,6 +996,7 @@ void ride_init_all()
 		ride = get_ride(i);
 		ride->type = RIDE_TYPE_NULL;
 	}
+	park_invalidate_statistics();
 
 	RCT2_GLOBAL(0x0138B590, sint8) = 0;
 	RCT2_GLOBAL(0x0138B591, sint8) = 0;
@@ -1890,8 +2033,10 @@ void ride_update_all()
 	// Remove all rides if scenario editor
 	if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR) {
 		if (s6Info->editor_step <= EDITOR_STEP_INVENTIONS_LIST_SET_UP)
-			FOR_ALL_RIDES(i, ride)
+			FOR_ALL_RIDES(i, ride) {
 				ride->type = RIDE_TYPE_NULL;
+				park_update_ride_rating_inputs(i);
+			}
 		return;
 	}
 
@@ -2191,6 +2336,7 @@ static void ride_breakdown_update(int rideIndex)
 			ride->downtime_history[6] +
 			ride->downtime_history[7];
 		ride->downtime = min(totalDowntime / 2, 100);
+		park_update_ride_rating_inputs(rideIndex);
 
 		memmove(&ride->downtime_history[1], ride->downtime_history, sizeof(ride->downtime_history) - 1);
 
@@ -2555,10 +2701,14 @@ rct_peep *find_closest_mechanic(int x, int y, int forInspection)
 	uint16 spriteIndex;
 	rct_peep *peep, *closestMechanic = NULL;
 
+	// Only mechanics are visited, in the same order as walking the peep list so ties go to the same mechanic
+	const uint16 *mechanics;
+	int numMechanics = staff_get_mechanics(&mechanics);
+
 	closestDistance = UINT_MAX;
-	FOR_ALL_STAFF(spriteIndex, peep) {
-		if (peep->staff_type != STAFF_TYPE_MECHANIC)
-			continue;
+	for (int i = 0; i < numMechanics; i++) {
+		spriteIndex = mechanics[i];
+		peep = GET_PEEP(spriteIndex);
 
 		if (!forInspection) {
 			if (peep->state == PEEP_STATE_HEADING_TO_INSPECTION){
@@ -5612,73 +5762,87 @@ int ride_get_refund_price(int ride_id)
 	gGamePaused = 0;
 	RCT2_GLOBAL(0x00F4413A, money32) = 0;
 
-	map_element_iterator it;
+	// Removing the track drops tiles from the ride's tile list so work from a copy
+	const rct_xy8 *rideTiles;
+	int numTiles = ride_get_track_tiles(ride_id, &rideTiles);
+	rct_xy8 *tiles = malloc(max(1, numTiles) * sizeof(rct_xy8));
+	memcpy(tiles, rideTiles, numTiles * sizeof(rct_xy8));
 
-	map_element_iterator_begin(&it);
-	while (map_element_iterator_next(&it)) {
-		if (map_element_get_type(it.element) != MAP_ELEMENT_TYPE_TRACK)
-			continue;
+	for (int i = 0; i < numTiles; i++) {
+		int x = tiles[i].x * 32, y = tiles[i].y * 32;
 
-		if (it.element->properties.track.ride_index != ride_id)
-			continue;
+		// Removing a piece shifts the elements of the tile, so look for the next piece from the start of the tile. A piece
+		// that is not removed (e.g. the command was only sent to the server) would be found again, so only try as many
+		// times as the tile has pieces.
+		int numAttempts = 0;
+		rct_map_element *mapElement = map_get_first_element_at(tiles[i].x, tiles[i].y);
+		do {
+			if (map_element_get_type(mapElement) == MAP_ELEMENT_TYPE_TRACK && mapElement->properties.track.ride_index == ride_id)
+				numAttempts++;
+		} while (!map_element_is_last_for_tile(mapElement++));
+
+		for (; numAttempts > 0; numAttempts--) {
+			mapElement = ride_get_first_track_element_on_tile(ride_id, tiles[i].x, tiles[i].y);
+			if (mapElement == NULL)
+				break;
 
-		int x = it.x * 32, y = it.y * 32;
-		int z = it.element->base_height * 8;
+			int z = mapElement->base_height * 8;
 
-		uint8 rotation = it.element->type & MAP_ELEMENT_DIRECTION_MASK;
-		uint8 type = it.element->properties.track.type;
+			uint8 rotation = mapElement->type & MAP_ELEMENT_DIRECTION_MASK;
+			uint8 type = mapElement->properties.track.type;
 
-		if (type != TRACK_ELEM_INVERTED_90_DEG_UP_TO_FLAT_QUARTER_LOOP){
+			if (type != TRACK_ELEM_INVERTED_90_DEG_UP_TO_FLAT_QUARTER_LOOP){
+				RCT2_GLOBAL(0x00F4413A, money32) += game_do_command(
+					x,
+					GAME_COMMAND_FLAG_APPLY | (rotation << 8),
+					y,
+					type | ((mapElement->properties.track.sequence & 0xF) << 8),
+					GAME_COMMAND_REMOVE_TRACK,
+					z,
+					0);
+				continue;
+			}
+
+			// Using GAME_COMMAND_FLAG_2 for below commands as a HACK to stop fences from being removed
 			RCT2_GLOBAL(0x00F4413A, money32) += game_do_command(
 				x,
-				GAME_COMMAND_FLAG_APPLY | (rotation << 8),
+				GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_2 | (0 << 8),
 				y,
-				type | ((it.element->properties.track.sequence & 0xF) << 8),
-				GAME_COMMAND_REMOVE_TRACK,
+				ride_id | (2 << 8),
+				GAME_COMMAND_SET_MAZE_TRACK,
 				z,
 				0);
-			map_element_iterator_restart_for_tile(&it);
-			continue;
-		}
 
-		// Using GAME_COMMAND_FLAG_2 for below commands as a HACK to stop fences from being removed
-		RCT2_GLOBAL(0x00F4413A, money32) += game_do_command(
-			x,
-			GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_2 | (0 << 8),
-			y,
-			ride_id | (2 << 8),
-			GAME_COMMAND_SET_MAZE_TRACK,
-			z,
-			0);
-
-		RCT2_GLOBAL(0x00F4413A, money32) += game_do_command(
-			x,
-			GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_2 | (1 << 8),
-			y + 16,
-			ride_id | (2 << 8),
-			GAME_COMMAND_SET_MAZE_TRACK,
-			z,
-			0);
-
-		RCT2_GLOBAL(0x00F4413A, money32) += game_do_command(
-			x + 16,
-			GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_2 | (2 << 8),
-			y + 16,
-			ride_id | (2 << 8),
-			GAME_COMMAND_SET_MAZE_TRACK,
-			z,
-			0);
-
-		RCT2_GLOBAL(0x00F4413A, money32) += game_do_command(
-			x + 16,
-			GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_2 | (3 << 8),
-			y,
-			ride_id | (2 << 8),
-			GAME_COMMAND_SET_MAZE_TRACK,
-			z,
-			0);
-		map_element_iterator_restart_for_tile(&it);
+			RCT2_GLOBAL(0x00F4413A, money32) += game_do_command(
+				x,
+				GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_2 | (1 << 8),
+				y + 16,
+				ride_id | (2 << 8),
+				GAME_COMMAND_SET_MAZE_TRACK,
+				z,
+				0);
+
+			RCT2_GLOBAL(0x00F4413A, money32) += game_do_command(
+				x + 16,
+				GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_2 | (2 << 8),
+				y + 16,
+				ride_id | (2 << 8),
+				GAME_COMMAND_SET_MAZE_TRACK,
+				z,
+				0);
+
+			RCT2_GLOBAL(0x00F4413A, money32) += game_do_command(
+				x + 16,
+				GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_2 | (3 << 8),
+				y,
+				ride_id | (2 << 8),
+				GAME_COMMAND_SET_MAZE_TRACK,
+				z,
+				0);
+		}
 	}
+	free(tiles);
+
 	gGamePaused = oldpaused;
 	return RCT2_GLOBAL(0x00F4413A, int);
 }
@@ -6115,6 +6279,7 @@ foundRideEntry:
 	ride->mode = ride_get_default_mode(ride);
 	ride->min_max_cars_per_train = (rideEntry->min_cars_in_train << 4) | rideEntry->max_cars_in_train;
 	ride_set_vehicle_colours_to_random_preset(ride, 0xFF & (*outRideColour >> 8));
+	park_update_ride_rating_inputs(rideIndex);
 	window_invalidate_by_class(WC_RIDE_LIST);
 
 	gCommandExpenditureType = RCT_EXPENDITURE_TYPE_RIDE_CONSTRUCTION;
@@ -6367,6 +6532,7 @@ void game_command_demolish_ride(int *eax, int *ebx, int *ecx, int *edx, int *esi
 
 			user_string_free(ride->name);
 			ride->type = RIDE_TYPE_NULL;
+			park_update_ride_rating_inputs(ride_id);
 			window_invalidate_by_class(WC_RIDE_LIST);
 			gParkValue = calculate_park_value();
 			gCommandPosition.x = x;
@@ -6867,18 +7033,20 @@ bool ride_is_block_sectioned(rct_ride *ride)
 
 bool ride_has_any_track_elements(int rideIndex)
 {
-	map_element_iterator it;
-
-	map_element_iterator_begin(&it);
-	while (map_element_iterator_next(&it)) {
-		if (map_element_get_type(it.element) != MAP_ELEMENT_TYPE_TRACK)
-			continue;
-		if (it.element->properties.track.ride_index != rideIndex)
-			continue;
-		if (it.element->flags & MAP_ELEMENT_FLAG_GHOST)
-			continue;
+	const rct_xy8 *tiles;
+	int numTiles = ride_get_track_tiles(rideIndex, &tiles);
+	for (int i = 0; i < numTiles; i++) {
+		rct_map_element *mapElement = map_get_first_element_at(tiles[i].x, tiles[i].y);
+		do {
+			if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK)
+				continue;
+			if (mapElement->properties.track.ride_index != rideIndex)
+				continue;
+			if (mapElement->flags & MAP_ELEMENT_FLAG_GHOST)
+				continue;
 
-		return true;
+			return true;
+		} while (!map_element_is_last_for_tile(mapElement++));
 	}
 
 	return false;
@@ -6886,94 +7054,92 @@ bool ride_has_any_track_elements(int rideIndex)
 
 void ride_all_has_any_track_elements(bool *rideIndexArray)
 {
-	map_element_iterator it;
+	for (int i = 0; i < MAX_RIDES; i++)
+		rideIndexArray[i] = ride_has_any_track_elements(i);
+}
 
-	memset(rideIndexArray, 0, MAX_RIDES * sizeof(bool));
+// Extents of the opaque pixels of a set of images drawn at 0, 0, measured as the original did on a 200x200 bitmap
+// centred on the origin
+typedef struct vehicle_image_extents {
+	int x;		// Furthest column either side of the origin, 0 if none
+	int up;		// Furthest row above the origin, 0 if none
+	int down;	// Furthest row below the origin, 0 if none
+} vehicle_image_extents;
 
-	map_element_iterator_begin(&it);
-	while (map_element_iterator_next(&it)) {
-		if (map_element_get_type(it.element) != MAP_ELEMENT_TYPE_TRACK)
-			continue;
-		if (it.element->flags & MAP_ELEMENT_FLAG_GHOST)
-			continue;
+static void vehicle_image_extents_add_pixel(vehicle_image_extents *extents, int x, int y)
+{
+	if (x < -100 || x > 99 || y < -100 || y > 99)
+		return;
 
-		rideIndexArray[it.element->properties.track.ride_index] = true;
-	}
+	if (x != 0 && x != -100)
+		extents->x = max(extents->x, abs(x));
+	if (y < 0 && y != -100)
+		extents->up = max(extents->up, -y);
+	if (y > 0)
+		extents->down = max(extents->down, y);
 }
 
 /**
- *
- *  rct2: 0x006847BA
+ * Widens the extents to cover an image, reading its pixels straight from the sprite data rather than drawing it.
+ * Images whose bounds are within the extents found so far are skipped without looking at their pixels.
  */
-void set_vehicle_type_image_max_sizes(rct_ride_entry_vehicle* vehicle_type, int num_images){
-	uint8 bitmap[200][200] = { 0 };
-
-	rct_drawpixelinfo dpi = {
-		.bits = (uint8*)bitmap,
-		.x = -100,
-		.y = -100,
-		.width = 200,
-		.height = 200,
-		.pitch = 0,
-		.zoom_level = 0
-	};
-
-	for (int i = 0; i < num_images; ++i){
-		gfx_draw_sprite(&dpi, vehicle_type->base_image_id + i, 0, 0, 0);
-	}
-	int al = -1;
-	for (int i = 99; i != 0; --i){
-		for (int j = 0; j < 200; j++){
-			if (bitmap[j][100 - i] != 0){
-				al = i;
-				break;
-			}
-		}
+static void vehicle_image_extents_add_image(vehicle_image_extents *extents, int imageId)
+{
+	rct_g1_element *g1 = gfx_get_g1_element(imageId);
+	if (g1->offset == NULL || g1->width <= 0 || g1->height <= 0)
+		return;
 
-		if (al != -1)
-			break;
+	int left = g1->x_offset;
+	int top = g1->y_offset;
+	int right = left + g1->width - 1;
+	int bottom = top + g1->height - 1;
+	if (max(abs(left), abs(right)) <= extents->x && -top <= extents->up && bottom <= extents->down)
+		return;
 
-		for (int j = 0; j < 200; j++){
-			if (bitmap[j][100 + i] != 0){
-				al = i;
-				break;
+	if (g1->flags & G1_FLAG_RLE_COMPRESSION) {
+		for (int row = 0; row < g1->height; row++) {
+			const uint8 *source = g1->offset + ((uint16*)g1->offset)[row];
+			bool lastRun;
+			do {
+				int numPixels = source[0] & 0x7F;
+				int gap = source[1];
+				lastRun = (source[0] & 0x80) != 0;
+				source += 2;
+				for (int i = 0; i < numPixels; i++) {
+					if (source[i] != 0)
+						vehicle_image_extents_add_pixel(extents, left + gap + i, top + row);
+				}
+				source += numPixels;
+			} while (!lastRun);
+		}
+	} else if (!(g1->flags & G1_FLAG_1)) {
+		const uint8 *source = g1->offset;
+		for (int row = 0; row < g1->height; row++) {
+			for (int column = 0; column < g1->width; column++) {
+				if (*source++ != 0)
+					vehicle_image_extents_add_pixel(extents, left + column, top + row);
 			}
 		}
-
-		if (al != -1)
-			break;
+	} else {
+		// Not used by vehicles, assume the whole image is opaque
+		vehicle_image_extents_add_pixel(extents, clamp(-99, left, 99), clamp(-99, top, 99));
+		vehicle_image_extents_add_pixel(extents, clamp(-99, right, 99), clamp(-99, bottom, 99));
 	}
+}
 
-	al++;
-	int bl = -1;
-
-	for (int i = 99; i != 0; --i){
-		for (int j = 0; j < 200; j++){
-			if (bitmap[100 - i][j] != 0){
-				bl = i;
-				break;
-			}
-		}
-
-		if (bl != -1)
-			break;
+/**
+ *
+ *  rct2: 0x006847BA
+ */
+void set_vehicle_type_image_max_sizes(rct_ride_entry_vehicle* vehicle_type, int num_images){
+	vehicle_image_extents extents = { 0 };
+	for (int i = 0; i < num_images; ++i){
+		vehicle_image_extents_add_image(&extents, vehicle_type->base_image_id + i);
 	}
-	bl++;
-
-	int bh = -1;
-
-	for (int i = 99; i != 0; --i){
-		for (int j = 0; j < 200; j++){
-			if (bitmap[100 + i][j] != 0){
-				bh = i;
-				break;
-			}
-		}
 
-		if (bh != -1)
-			break;
-	}
-	bh++;
+	int al = extents.x == 0 ? 0 : extents.x + 1;
+	int bl = extents.up == 0 ? 0 : extents.up + 1;
+	int bh = extents.down == 0 ? 0 : extents.down + 1;
 
 	// Moved from object paint
 
@@ -7279,6 +7445,7 @@ void invalidate_test_results(int rideIndex)
 
 	ride_measurement_clear(ride);
 	ride->excitement = 0xFFFF;
+	park_update_ride_rating_inputs(rideIndex);
 	ride->lifecycle_flags &= ~RIDE_LIFECYCLE_TESTED;
 	ride->lifecycle_flags &= ~RIDE_LIFECYCLE_TEST_IN_PROGRESS;
 	if (ride->lifecycle_flags & RIDE_LIFECYCLE_ON_TRACK) {
@@ -8605,4 +8772,5 @@ void ride_delete(uint8 rideIndex)
 	rct_ride *ride = get_ride(rideIndex);
 	user_string_free(ride->name);
 	ride->type = RIDE_TYPE_NULL;
+	park_update_ride_rating_inputs(rideIndex);
 }
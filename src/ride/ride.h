@@ -946,6 +946,9 @@ money16 get_shop_base_value(int shopItem);
 money16 get_shop_hot_value(int shopItem);
 money16 get_shop_cold_value(int shopItem);
 bool ride_try_get_origin_element(int rideIndex, rct_xy_element *output);
+void ride_track_registry_invalidate();
+void ride_track_registry_add(int rideIndex, int x, int y);
+int ride_get_track_tiles(int rideIndex, const rct_xy8 **outTiles);
 int ride_find_track_gap(rct_xy_element *input, rct_xy_element *output);
 void ride_construct_new(ride_list_item listItem);
 void ride_construct(int rideIndex);
@@ -18,6 +18,7 @@
 #include "../interface/window.h"
 #include "../localisation/date.h"
 #include "../world/map.h"
+#include "../world/park.h"
 #include "ride.h"
 #include "ride_data.h"
 #include "ride_ratings.h"
@@ -227,6 +228,7 @@ static void ride_ratings_update_state_3()
 
 	ride_ratings_calculate(ride);
 	ride_ratings_calculate_value(ride);
+	park_update_ride_rating_inputs(_rideRatingsCurrentRide);
 
 	window_invalidate_by_number(WC_RIDE, _rideRatingsCurrentRide);
 	_rideRatingsState = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
@@ -1003,6 +1003,7 @@ static money32 track_place(int rideIndex, int type, int originX, int originY, in
 		mapElement->properties.track.ride_index = rideIndex;
 		mapElement->properties.track.type = type;
 		mapElement->properties.track.colour = 0;
+		ride_track_registry_add(rideIndex, x / 32, y / 32);
 		if (flags & GAME_COMMAND_FLAG_GHOST){
 			mapElement->flags |= MAP_ELEMENT_FLAG_GHOST;
 		}
@@ -1510,6 +1511,7 @@ money32 set_maze_track(uint16 x, uint8 flags, uint8 direction, uint16 y, uint8 r
 		mapElement->properties.track.type = 0x65;
 		mapElement->properties.track.ride_index = rideIndex;
 		mapElement->properties.track.maze_entry = 0xFFFF;
+		ride_track_registry_add(rideIndex, x / 32, y / 32);
 
 		if (flags & GAME_COMMAND_FLAG_GHOST) {
 			mapElement->flags |= MAP_ELEMENT_FLAG_GHOST;
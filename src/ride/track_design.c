@@ -27,6 +27,7 @@
 #include "../util/util.h"
 #include "../windows/error.h"
 #include "../world/footpath.h"
+#include "../world/park.h"
 #include "../world/scenery.h"
 #include "ride.h"
 #include "ride_data.h"
@@ -1389,6 +1390,7 @@ bool sub_6D2189(rct_track_td6 *td6, money32 *cost, uint8 *rideId, uint8 *flags)
 		_currentTrackPieceDirection = backup_rotation;
 		user_string_free(ride->name);
 		ride->type = RIDE_TYPE_NULL;
+		park_update_ride_rating_inputs(rideIndex);
 		byte_9D8150 &= ~1;
 		return false;
 	}
@@ -1616,6 +1618,7 @@ money32 place_maze_design(uint8 flags, uint8 rideIndex, uint16 mazeEntry, sint16
 		mapElement->properties.track.type = 101;
 		mapElement->properties.track.ride_index = rideIndex;
 		mapElement->properties.track.maze_entry = mazeEntry;
+		ride_track_registry_add(rideIndex, fx >> 5, fy >> 5);
 		if (flags & GAME_COMMAND_FLAG_GHOST) {
 			mapElement->flags |= MAP_ELEMENT_FLAG_GHOST;
 		}
@@ -1848,6 +1851,10 @@ static void track_design_preview_restore_map(map_backup *backup)
 	gMapSizeMinus2 = backup->map_size_units_minus_2;
 	gMapSize = backup->map_size;
 	gCurrentRotation = backup->current_rotation;
+	footpath_invalidate_map_edge_connectivity();
+	map_invalidate_all_tile_element_types();
+	ride_track_registry_invalidate();
+	park_invalidate_statistics();
 
 	free(backup);
 }
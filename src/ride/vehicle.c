@@ -223,6 +223,45 @@ void vehicle_invalidate(rct_vehicle *vehicle)
 	invalidate_sprite_2((rct_sprite*)vehicle);
 }
 
+// Area of the sound viewport that vehicles can be heard in, worked out once per vehicle_sounds_update
+static sint16 _vehicleSoundAreaLeft;
+static sint16 _vehicleSoundAreaTop;
+static sint16 _vehicleSoundAreaRight;
+static sint16 _vehicleSoundAreaBottom;
+
+// Per sprite index: the gVehicleSoundList slot + 1 playing it (0 for none) and whether it is in gVehicleSoundParamsList.
+// Only filled in for the duration of vehicle_sounds_update, every entry is back to zero when it returns.
+#define VEHICLE_SOUND_SLOT_MASK 0x7F
+#define VEHICLE_SOUND_HAS_PARAMS 0x80
+static uint8 _vehicleSoundLookup[MAX_SPRITES];
+
+/**
+ * Works out the audible area for the current sound viewport, the view expanded by a quarter on each side when the
+ * viewport belongs to the main window.
+ */
+static void vehicle_sounds_update_area()
+{
+	rct_viewport *viewport = RCT2_GLOBAL(0x00F438A4, rct_viewport*);
+	sint16 x = viewport->view_x;
+	sint16 y = viewport->view_y;
+	sint16 w = viewport->view_width / 4;
+	sint16 h = viewport->view_height / 4;
+	if (!RCT2_GLOBAL(0x00F438A8, rct_window*)->classification) {
+		x -= w;
+		y -= h;
+	}
+	sint16 w2 = viewport->view_width + x;
+	sint16 h2 = viewport->view_height + y;
+	if (!RCT2_GLOBAL(0x00F438A8, rct_window*)->classification) {
+		w2 += w + w;
+		h2 += h + h;
+	}
+	_vehicleSoundAreaLeft = x;
+	_vehicleSoundAreaTop = y;
+	_vehicleSoundAreaRight = w2;
+	_vehicleSoundAreaBottom = h2;
+}
+
 /**
  *
  *  rct2: 0x006BB9FF
@@ -232,22 +271,8 @@ void vehicle_update_sound_params(rct_vehicle* vehicle)
 	if (!(gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR) && (!(gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) || RCT2_GLOBAL(0x0141F570, uint8) == 6)) {
 		if (vehicle->sound1_id != (uint8)-1 || vehicle->sound2_id != (uint8)-1) {
 			if (vehicle->sprite_left != (sint16)0x8000) {
-				sint16 x = RCT2_GLOBAL(0x00F438A4, rct_viewport*)->view_x;
-				sint16 y = RCT2_GLOBAL(0x00F438A4, rct_viewport*)->view_y;
-				sint16 w = RCT2_GLOBAL(0x00F438A4, rct_viewport*)->view_width / 4;
-				sint16 h = RCT2_GLOBAL(0x00F438A4, rct_viewport*)->view_height / 4;
-				if (!RCT2_GLOBAL(0x00F438A8, rct_window*)->classification) {
-					x -= w;
-					y -= h;
-				}
-				if (x < vehicle->sprite_right && y < vehicle->sprite_bottom) {
-					sint16 w2 = RCT2_GLOBAL(0x00F438A4, rct_viewport*)->view_width + x;
-					sint16 h2 = RCT2_GLOBAL(0x00F438A4, rct_viewport*)->view_height + y;
-					if (!RCT2_GLOBAL(0x00F438A8, rct_window*)->classification) {
-						w2 += w + w;
-						h2 += h + h;
-					}
-					if (w2 >= vehicle->sprite_left && h2 >= vehicle->sprite_top) {
+				if (_vehicleSoundAreaLeft < vehicle->sprite_right && _vehicleSoundAreaTop < vehicle->sprite_bottom) {
+					if (_vehicleSoundAreaRight >= vehicle->sprite_left && _vehicleSoundAreaBottom >= vehicle->sprite_top) {
 						uint16 v9 = sub_6BC2F3(vehicle);
 						rct_vehicle_sound_params* i;
 						for (i = &gVehicleSoundParamsList[0]; i < gVehicleSoundParamsListEnd && v9 <= i->var_A; i++);
@@ -377,16 +402,37 @@ void vehicle_sounds_update()
 				}
 			}
 			gVehicleSoundParamsListEnd = &gVehicleSoundParamsList[0];
-			for (uint16 i = gSpriteListHead[SPRITE_LIST_VEHICLE]; i != SPRITE_INDEX_NULL; i = g_sprite_list[i].vehicle.next) {
-				vehicle_update_sound_params(&g_sprite_list[i].vehicle);
+			if (!(gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR) && (!(gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) || RCT2_GLOBAL(0x0141F570, uint8) == 6)) {
+				vehicle_sounds_update_area();
+				for (uint16 i = gSpriteListHead[SPRITE_LIST_VEHICLE]; i != SPRITE_INDEX_NULL; i = g_sprite_list[i].vehicle.next) {
+					rct_vehicle *vehicle = &g_sprite_list[i].vehicle;
+
+					// Quick reject silent and off screen cars before working out any sound parameters
+					if (vehicle->sound1_id == (uint8)-1 && vehicle->sound2_id == (uint8)-1) {
+						continue;
+					}
+					if (vehicle->sprite_left == (sint16)0x8000 ||
+						_vehicleSoundAreaLeft >= vehicle->sprite_right || _vehicleSoundAreaTop >= vehicle->sprite_bottom ||
+						_vehicleSoundAreaRight < vehicle->sprite_left || _vehicleSoundAreaBottom < vehicle->sprite_top
+					) {
+						continue;
+					}
+					vehicle_update_sound_params(vehicle);
+				}
+			}
+
+			for (rct_vehicle_sound_params* vehicle_sound_params = &gVehicleSoundParamsList[0]; vehicle_sound_params != gVehicleSoundParamsListEnd; vehicle_sound_params++) {
+				_vehicleSoundLookup[vehicle_sound_params->id] = VEHICLE_SOUND_HAS_PARAMS;
 			}
 			for(int i = 0; i < countof(gVehicleSoundList); i++){
 				rct_vehicle_sound* vehicle_sound = &gVehicleSoundList[i];
 				if (vehicle_sound->id != (uint16)-1) {
-					for (rct_vehicle_sound_params* vehicle_sound_params = &gVehicleSoundParamsList[0]; vehicle_sound_params != gVehicleSoundParamsListEnd; vehicle_sound_params++) {
-						if (vehicle_sound->id == vehicle_sound_params->id) {
-							goto label26;
+					uint8 *lookup = &_vehicleSoundLookup[vehicle_sound->id];
+					if (*lookup & VEHICLE_SOUND_HAS_PARAMS) {
+						if (!(*lookup & VEHICLE_SOUND_SLOT_MASK)) {
+							*lookup |= i + 1;
 						}
+						continue;
 					}
 					if (vehicle_sound->sound1_id != (uint16)-1) {
 						Mixer_Stop_Channel(vehicle_sound->sound1_channel);
@@ -396,13 +442,15 @@ void vehicle_sounds_update()
 					}
 					vehicle_sound->id = (uint16)-1;
 				}
-			label26:
-				;
 			}
 
 			for (rct_vehicle_sound_params* vehicle_sound_params = &gVehicleSoundParamsList[0]; ; vehicle_sound_params++) {
 			label28:
 				if (vehicle_sound_params >= gVehicleSoundParamsListEnd) {
+					// Every sprite in the lookup is in the parameter list, so clearing those leaves it empty
+					for (vehicle_sound_params = &gVehicleSoundParamsList[0]; vehicle_sound_params != gVehicleSoundParamsListEnd; vehicle_sound_params++) {
+						_vehicleSoundLookup[vehicle_sound_params->id] = 0;
+					}
 					return;
 				}
 				uint8 vol1 = 0xFF;
@@ -458,26 +506,26 @@ void vehicle_sounds_update()
 					vol1 = vol1 - gVolumeAdjustZoom;
 				}
 
-				rct_vehicle_sound* vehicle_sound = &gVehicleSoundList[0];
-				while (vehicle_sound_params->id != vehicle_sound->id) {
-					vehicle_sound++;
-					if (vehicle_sound >= &gVehicleSoundList[countof(gVehicleSoundList)]) {
-						vehicle_sound = &gVehicleSoundList[0];
-						int i = 0;
-						while (vehicle_sound->id != (uint16)-1) {
-							vehicle_sound++;
-							i++;
-							if (i >= countof(gVehicleSoundList)) {
-								vehicle_sound_params = (rct_vehicle_sound_params*)((int)vehicle_sound_params + 10);
-								goto label28;
-							}
+				rct_vehicle_sound* vehicle_sound;
+				uint8 slot = _vehicleSoundLookup[vehicle_sound_params->id] & VEHICLE_SOUND_SLOT_MASK;
+				if (slot != 0) {
+					vehicle_sound = &gVehicleSoundList[slot - 1];
+				} else {
+					vehicle_sound = &gVehicleSoundList[0];
+					int i = 0;
+					while (vehicle_sound->id != (uint16)-1) {
+						vehicle_sound++;
+						i++;
+						if (i >= countof(gVehicleSoundList)) {
+							vehicle_sound_params++;
+							goto label28;
 						}
-						vehicle_sound->id = vehicle_sound_params->id;
-						vehicle_sound->sound1_id = (uint16)-1;
-						vehicle_sound->sound2_id = (uint16)-1;
-						vehicle_sound->volume = 0x30;
-						break;
 					}
+					vehicle_sound->id = vehicle_sound_params->id;
+					vehicle_sound->sound1_id = (uint16)-1;
+					vehicle_sound->sound2_id = (uint16)-1;
+					vehicle_sound->volume = 0x30;
+					_vehicleSoundLookup[vehicle_sound_params->id] |= i + 1;
 				}
 
 				int tempvolume = vehicle_sound->volume;
@@ -32,6 +32,7 @@
 #include "network/network.h"
 #include "openrct2.h"
 #include "peep/staff.h"
+#include "replay.h"
 #include "ride/ride.h"
 #include "scenario.h"
 #include "util/util.h"
@@ -101,6 +102,8 @@ void title_load()
 {
 	log_verbose("loading title");
 
+	replay_stop_recording();
+
 	if (gGamePaused & GAME_PAUSED_NORMAL)
 		pause_toggle();
 
@@ -862,6 +862,9 @@ static void window_map_init_map()
 {
 	memset(RCT2_GLOBAL(RCT2_ADDRESS_MAP_IMAGE_DATA, void*), 0x0A, 256 * 256 * sizeof(uint32));
 	RCT2_GLOBAL(0x00F1AD6C, uint32) = 0;
+
+	// The image was cleared so every tile has to be sampled again
+	window_map_invalidate_all_tiles();
 }
 
 /**
@@ -999,16 +1002,64 @@ static void window_map_transform_to_map_coords(sint16 *left, sint16 *top)
 	*top = x + y - 8;
 }
 
+// One bit per tile whose minimap pixel needs to be sampled again, with per column and row counts so clean rows of the
+// sweep are skipped without looking at their tiles
+static uint32 _mapWindowDirtyTiles[256 * 256 / 32];
+static uint16 _mapWindowDirtyTileCountX[256];
+static uint16 _mapWindowDirtyTileCountY[256];
+static uint8 _mapWindowPixelsTab = 0xFF;
+static uint8 _mapWindowPixelsRotation = 0xFF;
+
+// Number of peeps on each tile and the tiles that have any, used to draw one dot per occupied tile
+static uint8 _mapWindowPeepCount[256 * 256];
+static uint16 _mapWindowOccupiedTiles[MAX_SPRITES];
+
 /**
- *
- *  rct2: 0x0068DADA
+ * Marks a tile as changed so its minimap pixel is sampled again, x and y are tile coordinates.
  */
-static void window_map_paint_peep_overlay(rct_drawpixelinfo *dpi)
+void window_map_invalidate_tile(int x, int y)
+{
+	if (x < 0 || y < 0 || x > 255 || y > 255)
+		return;
+
+	int index = x + y * 256;
+	uint32 bit = 1u << (index & 31);
+	if (_mapWindowDirtyTiles[index >> 5] & bit)
+		return;
+
+	_mapWindowDirtyTiles[index >> 5] |= bit;
+	_mapWindowDirtyTileCountX[x]++;
+	_mapWindowDirtyTileCountY[y]++;
+}
+
+void window_map_invalidate_all_tiles()
+{
+	memset(_mapWindowDirtyTiles, 0xFF, sizeof(_mapWindowDirtyTiles));
+	for (int i = 0; i < 256; i++) {
+		_mapWindowDirtyTileCountX[i] = 256;
+		_mapWindowDirtyTileCountY[i] = 256;
+	}
+}
+
+static bool window_map_clear_dirty_tile(int x, int y)
+{
+	int index = x + y * 256;
+	uint32 bit = 1u << (index & 31);
+	if (!(_mapWindowDirtyTiles[index >> 5] & bit))
+		return false;
+
+	_mapWindowDirtyTiles[index >> 5] &= ~bit;
+	_mapWindowDirtyTileCountX[x]--;
+	_mapWindowDirtyTileCountY[y]--;
+	return true;
+}
+
+static void window_map_paint_flashing_peeps(rct_drawpixelinfo *dpi, uint8 staffFlashing)
 {
 	rct_peep *peep;
 	uint16 spriteIndex;
 
-	sint16 left, right, bottom, top;
+	sint16 left, top;
 	sint16 colour;
 
 	FOR_ALL_PEEPS(spriteIndex, peep) {
@@ -1018,32 +1069,62 @@ static void window_map_paint_peep_overlay(rct_drawpixelinfo *dpi)
 		if (left == SPRITE_LOCATION_NULL)
 			continue;
 
+		bool isStaff = peep->type == PEEP_TYPE_STAFF;
+		if (isStaff != (staffFlashing != 0))
+			continue;
+
+		if ((peep->flags & SPRITE_FLAGS_PEEP_FLASHING) == 0)
+			continue;
+
 		window_map_transform_to_map_coords(&left, &top);
+		if (isStaff) {
+			colour = (gWindowMapFlashingFlags & (1 << 15)) ? 0x8A : 0xA;
+		} else {
+			colour = (gWindowMapFlashingFlags & (1 << 15)) ? 0xAC : 0x15;
+		}
+		gfx_fill_rect(dpi, left - 1, top, left, top, colour);
+	}
+}
 
-		right = left;
-		bottom = top;
+/**
+ * Draws a dot for every tile with peeps on it rather than one per peep, crowded paths collapse into a single fill.
+ * Peeps in a flashing group are still drawn individually on top.
+ */
+static void window_map_paint_peep_overlay(rct_drawpixelinfo *dpi)
+{
+	rct_peep *peep;
+	uint16 spriteIndex;
+	sint16 x, y;
+	int numOccupiedTiles = 0;
 
-		colour = 0x14;
+	FOR_ALL_PEEPS(spriteIndex, peep) {
+		x = peep->x;
+		y = peep->y;
 
-		if ((peep->flags & SPRITE_FLAGS_PEEP_FLASHING) != 0) {
-			if (peep->type == PEEP_TYPE_STAFF) {
-				if ((gWindowMapFlashingFlags & (1 << 3)) != 0) {
-					colour = 0x8A;
-					left--;
-					if ((gWindowMapFlashingFlags & (1 << 15)) == 0)
-						colour = 0xA;
-				}
-			} else {
-				if ((gWindowMapFlashingFlags & (1 << 1)) != 0) {
-					colour = 0xAC;
-					left--;
-					if ((gWindowMapFlashingFlags & (1 << 15)) == 0)
-						colour = 0x15;
-				}
-			}
-		}
-		gfx_fill_rect(dpi, left, top, right, bottom, colour);
+		if (x == SPRITE_LOCATION_NULL || x < 0 || y < 0 || x >= 256 * 32 || y >= 256 * 32)
+			continue;
+
+		int tileIndex = (x >> 5) + (y >> 5) * 256;
+		if (_mapWindowPeepCount[tileIndex] == 0)
+			_mapWindowOccupiedTiles[numOccupiedTiles++] = tileIndex;
+		if (_mapWindowPeepCount[tileIndex] != 255)
+			_mapWindowPeepCount[tileIndex]++;
 	}
+
+	for (int i = 0; i < numOccupiedTiles; i++) {
+		int tileIndex = _mapWindowOccupiedTiles[i];
+		_mapWindowPeepCount[tileIndex] = 0;
+
+		x = ((tileIndex & 0xFF) << 5) + 16;
+		y = ((tileIndex >> 8) << 5) + 16;
+		window_map_transform_to_map_coords(&x, &y);
+		gfx_fill_rect(dpi, x, y, x, y, 0x14);
+	}
+
+	if (gWindowMapFlashingFlags & (1 << 3))
+		window_map_paint_flashing_peeps(dpi, 1);
+	if (gWindowMapFlashingFlags & (1 << 1))
+		window_map_paint_flashing_peeps(dpi, 0);
 }
 
 /**
@@ -1597,34 +1678,57 @@ static uint16 map_window_get_pixel_colour_ride(int x, int y)
 	return colour & 0xFFFF;
 }
 
+/**
+ * Samples the next row of the minimap sweep. Only tiles invalidated since they were last drawn are sampled, rows
+ * without any are skipped outright.
+ */
 static void map_window_set_pixels(rct_window *w)
 {
 	uint16 colour = 0, *destination;
 	int x = 0, y = 0, dx = 0, dy = 0;
 
-	destination = (uint16*)((RCT2_GLOBAL(0x00F1AD6C, uint32) * 511) + RCT2_GLOBAL(RCT2_ADDRESS_MAP_IMAGE_DATA, uint32) + 255);
+	// Every pixel changes when the page or rotation does
+	if (_mapWindowPixelsTab != w->selected_tab || _mapWindowPixelsRotation != get_current_rotation()) {
+		_mapWindowPixelsTab = (uint8)w->selected_tab;
+		_mapWindowPixelsRotation = get_current_rotation();
+		window_map_invalidate_all_tiles();
+	}
+
+	int row = RCT2_GLOBAL(0x00F1AD6C, uint32);
+	RCT2_GLOBAL(0x00F1AD6C, uint32)++;
+	if (RCT2_GLOBAL(0x00F1AD6C, uint32) >= 256)
+		RCT2_GLOBAL(0x00F1AD6C, uint32) = 0;
+
+	switch (get_current_rotation()) {
+	case 0: if (_mapWindowDirtyTileCountX[row] == 0) return; break;
+	case 1: if (_mapWindowDirtyTileCountY[row] == 0) return; break;
+	case 2: if (_mapWindowDirtyTileCountX[255 - row] == 0) return; break;
+	case 3: if (_mapWindowDirtyTileCountY[255 - row] == 0) return; break;
+	}
+
+	destination = (uint16*)((row * 511) + RCT2_GLOBAL(RCT2_ADDRESS_MAP_IMAGE_DATA, uint32) + 255);
 	switch (get_current_rotation()) {
 	case 0:
-		x = RCT2_GLOBAL(0x00F1AD6C, uint32) * 32;
+		x = row * 32;
 		y = 0;
 		dx = 0;
 		dy = 32;
 		break;
 	case 1:
 		x = 8192 - 32;
-		y = RCT2_GLOBAL(0x00F1AD6C, uint32) * 32;
+		y = row * 32;
 		dx = -32;
 		dy = 0;
 		break;
 	case 2:
-		x = (255 - RCT2_GLOBAL(0x00F1AD6C, uint32)) * 32;
+		x = (255 - row) * 32;
 		y = 8192 - 32;
 		dx = 0;
 		dy = -32;
 		break;
 	case 3:
 		x = 0;
-		y = (255 - RCT2_GLOBAL(0x00F1AD6C, uint32)) * 32;
+		y = (255 - row) * 32;
 		dx = 32;
 		dy = 0;
 		break;
@@ -1632,6 +1736,7 @@ static void map_window_set_pixels(rct_window *w)
 
 	for (int i = 0; i < 256; i++) {
 		if (
+			window_map_clear_dirty_tile(x >> 5, y >> 5) &&
 			x > 0 &&
 			y > 0 &&
 			x < gMapSizeUnits &&
@@ -1651,9 +1756,6 @@ static void map_window_set_pixels(rct_window *w)
 		y += dy;
 		destination = (uint16*)((int)destination + 513);
 	}
-	RCT2_GLOBAL(0x00F1AD6C, uint32)++;
-	if (RCT2_GLOBAL(0x00F1AD6C, uint32) >= 256)
-		RCT2_GLOBAL(0x00F1AD6C, uint32) = 0;
 }
 
 static void map_window_screen_to_map(int screenX, int screenY, int *mapX, int *mapY)
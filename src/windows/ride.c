@@ -1179,32 +1179,33 @@ void window_ride_disable_tabs(rct_window *w)
 
 static void window_ride_update_overall_view(uint8 ride_index) {
 	// Calculate x, y, z bounds of the entire ride using its track elements
-	map_element_iterator it;
-
-	map_element_iterator_begin(&it);
-
 	int minx = INT_MAX, miny = INT_MAX, minz = INT_MAX;
 	int maxx = INT_MIN, maxy = INT_MIN, maxz = INT_MIN;
 
-	while (map_element_iterator_next(&it)) {
-		if (map_element_get_type(it.element) != MAP_ELEMENT_TYPE_TRACK)
-			continue;
+	const rct_xy8 *tiles;
+	int numTiles = ride_get_track_tiles(ride_index, &tiles);
+	for (int i = 0; i < numTiles; i++) {
+		rct_map_element *mapElement = map_get_first_element_at(tiles[i].x, tiles[i].y);
+		do {
+			if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK)
+				continue;
 
-		if (it.element->properties.track.ride_index != ride_index)
-			continue;
+			if (mapElement->properties.track.ride_index != ride_index)
+				continue;
 
-		int x = it.x * 32;
-		int y = it.y * 32;
-		int z1 = it.element->base_height * 8;
-		int z2 = it.element->clearance_height * 8;
+			int x = tiles[i].x * 32;
+			int y = tiles[i].y * 32;
+			int z1 = mapElement->base_height * 8;
+			int z2 = mapElement->clearance_height * 8;
 
-		minx = min(minx, x);
-		miny = min(miny, y);
-		minz = min(minz, z1);
+			minx = min(minx, x);
+			miny = min(miny, y);
+			minz = min(minz, z1);
 
-		maxx = max(maxx, x);
-		maxy = max(maxy, y);
-		maxz = max(maxz, z2);
+			maxx = max(maxx, x);
+			maxy = max(maxy, y);
+			maxz = max(maxz, z2);
+		} while (!map_element_is_last_for_tile(mapElement++));
 	}
 
 	ride_overall_view *view = &ride_overall_views[ride_index];
@@ -557,6 +557,7 @@ void window_staff_overview_dropdown(rct_window *w, int widgetIndex, int dropdown
 	if (dropdownIndex == 1) {
 		rct_peep* peep = GET_PEEP(w->number);
 
+		staff_remove_from_greyed_patrol_areas(peep);
 		for (int i = 0; i < 128; i++)
 		{
 			RCT2_ADDRESS(RCT2_ADDRESS_STAFF_PATROL_AREAS + (peep->staff_id * 512), uint32)[i] = 0;
@@ -564,7 +565,6 @@ void window_staff_overview_dropdown(rct_window *w, int widgetIndex, int dropdown
 		RCT2_ADDRESS(RCT2_ADDRESS_STAFF_MODE_ARRAY, uint8)[peep->staff_id] &= ~2;
 
 		gfx_invalidate_screen();
-		staff_update_greyed_patrol_areas();
 	}
 	else {
 		if (!tool_set(w, widgetIndex, 22)) {
@@ -205,6 +205,7 @@ static void remove_element(int index)
 	rct_map_element *mapElement = map_get_first_element_at(window_tile_inspector_tile_x, window_tile_inspector_tile_y);
 	mapElement += index;
 	map_element_remove(mapElement);
+	map_invalidate_path_wide_flags(window_tile_inspector_tile_x << 5, window_tile_inspector_tile_y << 5);
 	window_tile_inspector_item_count--;
 	map_invalidate_tile_full(window_tile_inspector_tile_x << 5, window_tile_inspector_tile_y << 5);
 }
@@ -190,6 +190,8 @@ static money32 footpath_element_insert(int type, int x, int y, int z, int slope,
 		mapElement->flags &= ~MAP_ELEMENT_FLAG_BROKEN;
 		if (flags & (1 << 6))
 			mapElement->flags |= MAP_ELEMENT_FLAG_GHOST;
+		else
+			map_invalidate_path_wide_flags(x, y);
 
 		RCT2_GLOBAL(0x00F3EFF4, uint32) = 0x00F3EFF8;
 
@@ -296,6 +298,8 @@ static money32 footpath_element_update(int x, int y, rct_map_element *mapElement
 
 		mapElement->properties.path.type = (mapElement->properties.path.type & 0x0F) | (type << 4);
 		mapElement->type = (mapElement->type & 0xFE) | (type >> 7);
+		footpath_invalidate_map_edge_connectivity();
+		map_invalidate_path_wide_flags(x, y);
 		footpath_element_set_path_scenery(mapElement, pathItemType);
 		mapElement->flags &= ~MAP_ELEMENT_FLAG_BROKEN;
 
@@ -528,6 +532,8 @@ static money32 footpath_place_from_track(int type, int x, int y, int z, int slop
 		mapElement->flags &= ~MAP_ELEMENT_FLAG_BROKEN;
 		if (flags & (1 << 6))
 			mapElement->flags |= MAP_ELEMENT_FLAG_GHOST;
+		else
+			map_invalidate_path_wide_flags(x, y);
 
 		map_invalidate_tile_full(x, y);
 	}
@@ -1272,6 +1278,11 @@ void footpath_connect_edges(int x, int y, rct_map_element *mapElement, int flags
 	rct_neighbour_list neighbourList;
 	rct_neighbour neighbour;
 
+	footpath_invalidate_map_edge_connectivity();
+	if (!(mapElement->flags & MAP_ELEMENT_FLAG_GHOST)) {
+		map_invalidate_path_wide_flags(x, y);
+	}
+
 	sub_6A759F();
 
 	neighbour_list_init(&neighbourList);
@@ -1322,6 +1333,9 @@ void footpath_chain_ride_queue(int rideIndex, int entranceIndex, int x, int y, r
 	rct_map_element *lastPathElement, *lastQueuePathElement;
 	int lastPathX = x, lastPathY = y, lastPathDirection = direction;
 
+	footpath_invalidate_map_edge_connectivity();
+	map_invalidate_path_wide_flags(x, y);
+
 	lastPathElement = NULL;
 	lastQueuePathElement = NULL;
 	int z = mapElement->base_height;
@@ -1491,6 +1505,47 @@ bool get_next_direction(int edges, int *direction)
 	return true;
 }
 
+/**
+ * Whether a path element entered at height z travelling in the given direction joins up with the previous path.
+ */
+static bool footpath_element_is_entered_at(rct_map_element *mapElement, int z, int direction)
+{
+	int slopeDirection;
+	if (
+		footpath_element_is_sloped(mapElement) &&
+		(slopeDirection = footpath_element_get_slope_direction(mapElement)) != direction
+	) {
+		if ((slopeDirection ^ 2) != direction) return false;
+		if (mapElement->base_height + 2 != z) return false;
+	} else if (mapElement->base_height != z) {
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Gets the edges of a path element, excluding any that are blocked by a no entry banner.
+ */
+static int footpath_element_get_unblocked_edges(rct_map_element *mapElement)
+{
+	int edges = mapElement->properties.path.edges & 0x0F;
+	if (mapElement[1].type == MAP_ELEMENT_TYPE_BANNER) {
+		for (int i = 1; i < 4; i++) {
+			if (map_element_is_last_for_tile(&mapElement[i - 1])) break;
+			if (mapElement[i].type != MAP_ELEMENT_TYPE_BANNER) break;
+			edges &= mapElement[i].properties.banner.flags;
+		}
+	}
+	if (mapElement[2].type == MAP_ELEMENT_TYPE_BANNER && mapElement[1].type != MAP_ELEMENT_TYPE_PATH) {
+		for (int i = 1; i < 6; i++) {
+			if (map_element_is_last_for_tile(&mapElement[i - 1])) break;
+			if (mapElement[i].type != MAP_ELEMENT_TYPE_BANNER) break;
+			edges &= mapElement[i].properties.banner.flags;
+		}
+	}
+	return edges;
+}
+
 /**
  *
  *  rct2: 0x0069AC1A
@@ -1500,7 +1555,7 @@ int footpath_is_connected_to_map_edge_recurse(
 	int level, int distanceFromJunction, int junctionTolerance
 ) {
 	rct_map_element *mapElement;
-	int edges, slopeDirection;
+	int edges;
 
 	x += TileDirectionDelta[direction].x;
 	y += TileDirectionDelta[direction].y;
@@ -1518,38 +1573,19 @@ int footpath_is_connected_to_map_edge_recurse(
 		if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_PATH)
 			continue;
 
-		if (
-			footpath_element_is_sloped(mapElement) &&
-			(slopeDirection = footpath_element_get_slope_direction(mapElement)) != direction
-		) {
-			if ((slopeDirection ^ 2) != direction) continue;
-			if (mapElement->base_height + 2 != z) continue;
-		} else if (mapElement->base_height != z) {
+		if (!footpath_element_is_entered_at(mapElement, z, direction))
 			continue;
-		}
 
 		if (mapElement->type & RCT2_GLOBAL(0x00F1AEE0, uint8)) continue;
 
 		if (flags & 0x20) {
 			footpath_unown(x, y, mapElement);
 		}
-		edges = mapElement->properties.path.edges & 0x0F;
 		direction ^= 2;
 		if (!(flags & 0x80)) {
-			if (mapElement[1].type == MAP_ELEMENT_TYPE_BANNER) {
-				for (int i = 1; i < 4; i++) {
-					if (map_element_is_last_for_tile(&mapElement[i - 1])) break;
-					if (mapElement[i].type != MAP_ELEMENT_TYPE_BANNER) break;
-					edges &= mapElement[i].properties.banner.flags;
-				}
-			}
-			if (mapElement[2].type == MAP_ELEMENT_TYPE_BANNER && mapElement[1].type != MAP_ELEMENT_TYPE_PATH) {
-				for (int i = 1; i < 6; i++) {
-					if (map_element_is_last_for_tile(&mapElement[i - 1])) break;
-					if (mapElement[i].type != MAP_ELEMENT_TYPE_BANNER) break;
-					edges &= mapElement[i].properties.banner.flags;
-				}
-			}
+			edges = footpath_element_get_unblocked_edges(mapElement);
+		} else {
+			edges = mapElement->properties.path.edges & 0x0F;
 		}
 		goto searchFromFootpath;
 	} while (!map_element_is_last_for_tile(mapElement++));
@@ -1600,10 +1636,230 @@ searchFromFootpath:
 	}
 }
 
+static bool _footpathMapEdgeConnectivityValid = false;
+static uint8 _footpathConnectedToMapEdge[MAX_MAP_ELEMENTS / 8];
+
+typedef struct rct_footpath_search_node {
+	uint8 x;
+	uint8 y;
+	uint32 index;
+	uint32 parent;
+} rct_footpath_search_node;
+
+static rct_footpath_search_node *_footpathSearchQueue = NULL;
+static uint8 _footpathRouteVisited[MAX_MAP_ELEMENTS / 8];
+
+static bool footpath_element_is_connected_to_map_edge(rct_map_element *mapElement)
+{
+	uint32 index = mapElement - gMapElements;
+	return _footpathConnectedToMapEdge[index >> 3] & (1 << (index & 7));
+}
+
+/**
+ * Marks a path element as connected to the map edge and queues it so that the
+ * paths leading onto it are visited.
+ */
+static void footpath_mark_connected_to_map_edge(int x, int y, rct_map_element *mapElement, int *queueLength)
+{
+	uint32 index = mapElement - gMapElements;
+	_footpathConnectedToMapEdge[index >> 3] |= 1 << (index & 7);
+	_footpathSearchQueue[*queueLength].x = x;
+	_footpathSearchQueue[*queueLength].y = y;
+	_footpathSearchQueue[*queueLength].index = index;
+	_footpathSearchQueue[*queueLength].parent = UINT32_MAX;
+	(*queueLength)++;
+}
+
+static bool footpath_element_is_walkable(rct_map_element *mapElement)
+{
+	return map_element_get_type(mapElement) == MAP_ELEMENT_TYPE_PATH && !footpath_element_is_queue(mapElement);
+}
+
+/**
+ * Labels every path element that leads to the edge of the map by walking backwards from the paths that leave the map,
+ * this replaces the depth limited search with a single pass over the footpath network.
+ */
+static bool footpath_update_map_edge_connectivity()
+{
+	if (_footpathSearchQueue == NULL) {
+		_footpathSearchQueue = malloc(MAX_MAP_ELEMENTS * sizeof(rct_footpath_search_node));
+		if (_footpathSearchQueue == NULL) {
+			log_error("Unable to allocate footpath search queue.");
+			return false;
+		}
+	}
+	memset(_footpathConnectedToMapEdge, 0, sizeof(_footpathConnectedToMapEdge));
+
+	int queueLength = 0;
+	for (int y = 0; y < 256; y++) {
+		for (int x = 0; x < 256; x++) {
+			rct_map_element *mapElement = map_get_first_element_at(x, y);
+			do {
+				if (!footpath_element_is_walkable(mapElement))
+					continue;
+
+				int edges = footpath_element_get_unblocked_edges(mapElement);
+				for (int direction = 0; direction < 4; direction++) {
+					if (!(edges & (1 << direction)))
+						continue;
+
+					int nextX = x * 32 + TileDirectionDelta[direction].x;
+					int nextY = y * 32 + TileDirectionDelta[direction].y;
+					if (nextX < 32 || nextY < 32 || nextX >= gMapSizeUnits || nextY >= gMapSizeUnits) {
+						footpath_mark_connected_to_map_edge(x, y, mapElement, &queueLength);
+						break;
+					}
+				}
+			} while (!map_element_is_last_for_tile(mapElement++));
+		}
+	}
+
+	for (int i = 0; i < queueLength; i++) {
+		rct_footpath_search_node node = _footpathSearchQueue[i];
+		rct_map_element *nextElement = &gMapElements[node.index];
+		for (int direction = 0; direction < 4; direction++) {
+			int x = node.x - TileDirectionDelta[direction].x / 32;
+			int y = node.y - TileDirectionDelta[direction].y / 32;
+			if (x < 0 || y < 0 || x >= 256 || y >= 256)
+				continue;
+
+			rct_map_element *mapElement = map_get_first_element_at(x, y);
+			do {
+				if (!footpath_element_is_walkable(mapElement))
+					continue;
+				if (footpath_element_is_connected_to_map_edge(mapElement))
+					continue;
+				if (!(footpath_element_get_unblocked_edges(mapElement) & (1 << direction)))
+					continue;
+
+				int z = mapElement->base_height;
+				if (footpath_element_is_sloped(mapElement) && footpath_element_get_slope_direction(mapElement) == direction) {
+					z += 2;
+				}
+				if (footpath_element_is_entered_at(nextElement, z, direction)) {
+					footpath_mark_connected_to_map_edge(x, y, mapElement, &queueLength);
+				}
+			} while (!map_element_is_last_for_tile(mapElement++));
+		}
+	}
+
+	_footpathMapEdgeConnectivityValid = true;
+	return true;
+}
+
+/**
+ * Unowns the land under the shortest route from the given path element to the map edge. Only paths already labelled
+ * as leading to the map edge are followed, so this walks the same network the labelling found.
+ */
+static int footpath_unown_route_to_map_edge(int x, int y, rct_map_element *startElement)
+{
+	memset(_footpathRouteVisited, 0, sizeof(_footpathRouteVisited));
+
+	uint32 startIndex = startElement - gMapElements;
+	_footpathRouteVisited[startIndex >> 3] |= 1 << (startIndex & 7);
+	_footpathSearchQueue[0].x = x;
+	_footpathSearchQueue[0].y = y;
+	_footpathSearchQueue[0].index = startIndex;
+	_footpathSearchQueue[0].parent = UINT32_MAX;
+
+	int queueLength = 1;
+	for (int i = 0; i < queueLength; i++) {
+		rct_footpath_search_node node = _footpathSearchQueue[i];
+		rct_map_element *mapElement = &gMapElements[node.index];
+		int edges = footpath_element_get_unblocked_edges(mapElement);
+		for (int direction = 0; direction < 4; direction++) {
+			if (!(edges & (1 << direction)))
+				continue;
+
+			int nextX = node.x * 32 + TileDirectionDelta[direction].x;
+			int nextY = node.y * 32 + TileDirectionDelta[direction].y;
+			if (nextX < 32 || nextY < 32 || nextX >= gMapSizeUnits || nextY >= gMapSizeUnits) {
+				for (uint32 j = i; j != UINT32_MAX; j = _footpathSearchQueue[j].parent) {
+					rct_footpath_search_node *routeNode = &_footpathSearchQueue[j];
+					footpath_unown(routeNode->x * 32, routeNode->y * 32, &gMapElements[routeNode->index]);
+				}
+				return FOOTPATH_SEARCH_SUCCESS;
+			}
+
+			int z = mapElement->base_height;
+			if (footpath_element_is_sloped(mapElement) && footpath_element_get_slope_direction(mapElement) == direction) {
+				z += 2;
+			}
+
+			rct_map_element *nextElement = map_get_first_element_at(nextX >> 5, nextY >> 5);
+			do {
+				if (!footpath_element_is_walkable(nextElement))
+					continue;
+				if (!footpath_element_is_connected_to_map_edge(nextElement))
+					continue;
+
+				uint32 index = nextElement - gMapElements;
+				if (_footpathRouteVisited[index >> 3] & (1 << (index & 7)))
+					continue;
+				if (!footpath_element_is_entered_at(nextElement, z, direction))
+					continue;
+
+				_footpathRouteVisited[index >> 3] |= 1 << (index & 7);
+				_footpathSearchQueue[queueLength].x = nextX >> 5;
+				_footpathSearchQueue[queueLength].y = nextY >> 5;
+				_footpathSearchQueue[queueLength].index = index;
+				_footpathSearchQueue[queueLength].parent = i;
+				queueLength++;
+			} while (!map_element_is_last_for_tile(nextElement++));
+		}
+	}
+	return FOOTPATH_SEARCH_INCOMPLETE;
+}
+
+/**
+ * Must be called whenever map elements are added, removed or moved, or path edges change.
+ */
+void footpath_invalidate_map_edge_connectivity()
+{
+	_footpathMapEdgeConnectivityValid = false;
+}
+
+void footpath_dispose()
+{
+	SafeFree(_footpathSearchQueue);
+	_footpathMapEdgeConnectivityValid = false;
+}
+
 int footpath_is_connected_to_map_edge(int x, int y, int z, int direction, int flags)
 {
 	RCT2_GLOBAL(0x00F1AEE0, uint8) = 1;
-	return footpath_is_connected_to_map_edge_recurse(x, y, z, direction, flags, 0, 0, 16);
+
+	if (flags & 0x80) {
+		return footpath_is_connected_to_map_edge_recurse(x, y, z, direction, flags, 0, 0, 16);
+	}
+
+	x += TileDirectionDelta[direction].x;
+	y += TileDirectionDelta[direction].y;
+	if (x < 32 || y < 32 || x >= gMapSizeUnits || y >= gMapSizeUnits)
+		return FOOTPATH_SEARCH_SUCCESS;
+
+	rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
+	do {
+		if (!footpath_element_is_walkable(mapElement))
+			continue;
+		if (!footpath_element_is_entered_at(mapElement, z, direction))
+			continue;
+
+		if (!(footpath_element_get_unblocked_edges(mapElement) & ~(1 << (direction ^ 2))))
+			return FOOTPATH_SEARCH_INCOMPLETE;
+
+		if (!_footpathMapEdgeConnectivityValid && !footpath_update_map_edge_connectivity()) {
+			return FOOTPATH_SEARCH_TOO_COMPLEX;
+		}
+		if (!footpath_element_is_connected_to_map_edge(mapElement)) {
+			return FOOTPATH_SEARCH_INCOMPLETE;
+		}
+		if (flags & 0x20) {
+			return footpath_unown_route_to_map_edge(x >> 5, y >> 5, mapElement);
+		}
+		return FOOTPATH_SEARCH_SUCCESS;
+	} while (!map_element_is_last_for_tile(mapElement++));
+	return FOOTPATH_SEARCH_NOT_FOUND;
 }
 
 bool footpath_element_is_sloped(rct_map_element *mapElement)
@@ -1681,6 +1937,23 @@ static void footpath_clear_wide(int x, int y)
 	} while (!map_element_is_last_for_tile(mapElement++));
 }
 
+/**
+ * Gets a mask of which elements on the tile are wide paths.
+ */
+static uint32 footpath_get_wide_elements(int x, int y)
+{
+	uint32 mask = 0;
+	int index = 0;
+	rct_map_element *mapElement = map_get_first_element_at(x / 32, y / 32);
+	do {
+		if (map_element_get_type(mapElement) == MAP_ELEMENT_TYPE_PATH && footpath_element_is_wide(mapElement)) {
+			mask |= 1u << (index & 31);
+		}
+		index++;
+	} while (!map_element_is_last_for_tile(mapElement++));
+	return mask;
+}
+
 /**
 *
 *  rct2: 0x006A8ACF
@@ -1699,6 +1972,9 @@ static rct_map_element* footpath_can_be_wide(int x, int y, uint8 height)
 			continue;
 		if (footpath_element_is_sloped(mapElement))
 			continue;
+		// Ghosts only exist for the player placing them
+		if (mapElement->flags & MAP_ELEMENT_FLAG_GHOST)
+			continue;
 		return mapElement;
 	} while (!map_element_is_last_for_tile(mapElement++));
 
@@ -1710,30 +1986,24 @@ static rct_map_element* footpath_can_be_wide(int x, int y, uint8 height)
 *
 *  rct2: 0x006A87BB
 */
-void footpath_update_path_wide_flags(int x, int y)
+bool footpath_update_path_wide_flags(int x, int y)
 {
 	if (x < 0x20)
-		return;
+		return false;
 	if (y < 0x20)
-		return;
+		return false;
 	if (x > 0x1FDF)
-		return;
+		return false;
 	if (y > 0x1FDF)
-		return;
+		return false;
 
+	uint32 wideElements = footpath_get_wide_elements(x, y);
 	footpath_clear_wide(x, y);
-	x += 0x20;
-	footpath_clear_wide(x, y);
-	y += 0x20;
-	footpath_clear_wide(x, y);
-	x -= 0x20;
-	footpath_clear_wide(x, y);
-	y -= 0x20;
 
 	if (!(x & 0xE0))
-		return;
+		return wideElements != 0;
 	if (!(y & 0xE0))
-		return;
+		return wideElements != 0;
 
 	rct_map_element *mapElement = map_get_first_element_at(x / 32, y / 32);
 	do {
@@ -1746,6 +2016,9 @@ void footpath_update_path_wide_flags(int x, int y)
 		if (footpath_element_is_sloped(mapElement))
 			continue;
 
+		if (mapElement->flags & MAP_ELEMENT_FLAG_GHOST)
+			continue;
+
 		uint8 height = mapElement->base_height;
 
 		// pathList is a list of elements, set by sub_6A8ACF adjacent to x,y
@@ -1771,11 +2044,19 @@ void footpath_update_path_wide_flags(int x, int y)
 		pathList[7] = footpath_can_be_wide(x, y, height);
 		y += 0x20;
 
+		// Tiles are updated in rows from the top of the map, the tiles after this one in that order
+		// are treated as not being wide as the original full map sweep cleared them before getting here.
+		bool isWide[8];
+		for (int i = 0; i < 8; i++) {
+			isWide[i] = pathList[i] != NULL && footpath_element_is_wide(pathList[i]);
+		}
+		isWide[2] = isWide[3] = isWide[4] = isWide[5] = false;
+
 		uint8 F3EFA5 = 0;
 		if (mapElement->properties.path.edges & 8) {
 			F3EFA5 |= 0x80;
 			if (pathList[7] != NULL) {
-				if (footpath_element_is_wide(pathList[7])) {
+				if (isWide[7]) {
 					F3EFA5 &= ~0x80;
 				}
 			}
@@ -1784,7 +2065,7 @@ void footpath_update_path_wide_flags(int x, int y)
 		if (mapElement->properties.path.edges & 1) {
 			F3EFA5 |= 0x2;
 			if (pathList[1] != NULL) {
-				if (footpath_element_is_wide(pathList[1])) {
+				if (isWide[1]) {
 					F3EFA5 &= ~0x2;
 				}
 			}
@@ -1793,7 +2074,7 @@ void footpath_update_path_wide_flags(int x, int y)
 		if (mapElement->properties.path.edges & 2) {
 			F3EFA5 |= 0x8;
 			if (pathList[3] != NULL) {
-				if (footpath_element_is_wide(pathList[3])) {
+				if (isWide[3]) {
 					F3EFA5 &= ~0x8;
 				}
 			}
@@ -1802,41 +2083,41 @@ void footpath_update_path_wide_flags(int x, int y)
 		if (mapElement->properties.path.edges & 4) {
 			F3EFA5 |= 0x20;
 			if (pathList[5] != NULL) {
-				if (footpath_element_is_wide(pathList[5])) {
+				if (isWide[5]) {
 					F3EFA5 &= ~0x20;
 				}
 			}
 		}
 
-		if ((F3EFA5 & 0x80) && (pathList[7] != NULL) && !(footpath_element_is_wide(pathList[7]))) {
+		if ((F3EFA5 & 0x80) && (pathList[7] != NULL) && !(isWide[7])) {
 			if ((F3EFA5 & 2) &&
-				(pathList[0] != NULL) && (!footpath_element_is_wide(pathList[0])) &&
+				(pathList[0] != NULL) && (!isWide[0]) &&
 				((pathList[0]->properties.path.edges & 6) == 6) && // N E
-				(pathList[1] != NULL) && (!footpath_element_is_wide(pathList[1]))) {
+				(pathList[1] != NULL) && (!isWide[1])) {
 				F3EFA5 |= 0x1;
 			}
 
 			if ((F3EFA5 & 0x20) &&
-				(pathList[6] != NULL) && (!footpath_element_is_wide(pathList[6])) &&
+				(pathList[6] != NULL) && (!isWide[6]) &&
 				((pathList[6]->properties.path.edges & 3) == 3) && // N W
-				(pathList[5] != NULL) && (!footpath_element_is_wide(pathList[5]))) {
+				(pathList[5] != NULL) && (!isWide[5])) {
 				F3EFA5 |= 0x40;
 			}
 		}
 
 
-		if ((F3EFA5 & 0x8) && (pathList[3] != NULL) && !(pathList[3]->type & 2)) {
+		if ((F3EFA5 & 0x8) && (pathList[3] != NULL) && !isWide[3]) {
 			if ((F3EFA5 & 2) &&
-				(pathList[2] != NULL) && (!footpath_element_is_wide(pathList[2])) &&
+				(pathList[2] != NULL) && (!isWide[2]) &&
 				((pathList[2]->properties.path.edges & 0xC) == 0xC) &&
-				(pathList[1] != NULL) && (!footpath_element_is_wide(pathList[1]))) {
+				(pathList[1] != NULL) && (!isWide[1])) {
 				F3EFA5 |= 0x4;
 			}
 
 			if ((F3EFA5 & 0x20) &&
-				(pathList[4] != NULL) && (!footpath_element_is_wide(pathList[4])) &&
+				(pathList[4] != NULL) && (!isWide[4]) &&
 				((pathList[4]->properties.path.edges & 9) == 9) &&
-				(pathList[5] != NULL) && (!footpath_element_is_wide(pathList[5]))) {
+				(pathList[5] != NULL) && (!isWide[5])) {
 				F3EFA5 |= 0x10;
 			}
 		}
@@ -1859,6 +2140,8 @@ void footpath_update_path_wide_flags(int x, int y)
 				mapElement->type |= 2;
 		}
 	} while (!map_element_is_last_for_tile(mapElement++));
+
+	return footpath_get_wide_elements(x, y) != wideElements;
 }
 
 
@@ -1994,6 +2277,11 @@ void footpath_remove_edges_at(int x, int y, rct_map_element *mapElement)
 	rct_ride *ride;
 	int z0, z1, slope;
 
+	footpath_invalidate_map_edge_connectivity();
+	if (!(mapElement->flags & MAP_ELEMENT_FLAG_GHOST)) {
+		map_invalidate_path_wide_flags(x, y);
+	}
+
 	if (map_element_get_type(mapElement) == MAP_ELEMENT_TYPE_TRACK) {
 		int rideIndex = mapElement->properties.track.ride_index;
 		ride = get_ride(rideIndex);
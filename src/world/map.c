@@ -20,6 +20,7 @@
 #include "../config.h"
 #include "../cursors.h"
 #include "../game.h"
+#include "../interface/viewport.h"
 #include "../interface/window.h"
 #include "../localisation/date.h"
 #include "../localisation/localisation.h"
@@ -171,6 +172,57 @@ void map_element_iterator_restart_for_tile(map_element_iterator *it)
 	it->element = NULL;
 }
 
+// One bit per MAP_ELEMENT_TYPE for the element types found on each tile, 0 if the tile has to be scanned again.
+// Bits are only cleared by a rescan, so after an element is removed the mask may still list its type.
+static uint8 _tileElementTypes[256 * 256];
+
+// The tile of the last inserted element, its type is only set by the caller after map_element_insert returns
+static sint32 _tileElementTypesPendingTile = -1;
+
+/**
+ * Checks whether the tile may contain an element of the given type, so that lookups can skip tiles without one.
+ * @param x x tile.
+ * @param y y tile.
+ * @param type MAP_ELEMENT_TYPE_*.
+ */
+static bool map_tile_may_contain_element_type(int x, int y, int type)
+{
+	// Let the caller deal with invalid tiles as before
+	if (x < 0 || y < 0 || x > 255 || y > 255)
+		return true;
+
+	int tileIndex = x + y * 256;
+	if (tileIndex == _tileElementTypesPendingTile)
+		return true;
+
+	uint8 types = _tileElementTypes[tileIndex];
+	if (types == 0) {
+		rct_map_element *mapElement = TILE_MAP_ELEMENT_POINTER(tileIndex);
+		if (mapElement == TILE_UNDEFINED_MAP_ELEMENT)
+			return true;
+
+		do {
+			types |= 1 << (map_element_get_type(mapElement) >> 2);
+		} while (!map_element_is_last_for_tile(mapElement++));
+		_tileElementTypes[tileIndex] = types;
+	}
+	return (types & (1 << (type >> 2))) != 0;
+}
+
+static void map_invalidate_tile_element_types(int x, int y)
+{
+	if (x < 0 || y < 0 || x > 255 || y > 255)
+		return;
+
+	_tileElementTypes[x + y * 256] = 0;
+}
+
+void map_invalidate_all_tile_element_types()
+{
+	memset(_tileElementTypes, 0, sizeof(_tileElementTypes));
+	_tileElementTypesPendingTile = -1;
+}
+
 rct_map_element *map_get_first_element_at(int x, int y)
 {
 	if (x < 0 || y < 0 || x > 255 || y > 255) {
@@ -187,6 +239,7 @@ void map_set_tile_elements(int x, int y, rct_map_element *elements)
 		return;
 	}
 	TILE_MAP_ELEMENT_POINTER(x + y * 256) = elements;
+	map_invalidate_tile_element_types(x, y);
 }
 
 int map_element_is_last_for_tile(const rct_map_element *element)
@@ -265,6 +318,9 @@ rct_map_element *map_get_surface_element_at(int x, int y)
 }
 
 rct_map_element* map_get_path_element_at(int x, int y, int z){
+	if (!map_tile_may_contain_element_type(x, y, MAP_ELEMENT_TYPE_PATH))
+		return NULL;
+
 	rct_map_element *mapElement = map_get_first_element_at(x, y);
 
 	if (mapElement == NULL)
@@ -284,6 +340,9 @@ rct_map_element* map_get_path_element_at(int x, int y, int z){
 }
 
 rct_map_element* map_get_banner_element_at(int x, int y, int z, uint8 position) {
+	if (!map_tile_may_contain_element_type(x, y, MAP_ELEMENT_TYPE_BANNER))
+		return NULL;
+
 	rct_map_element *mapElement = map_get_first_element_at(x, y);
 
 	if (mapElement == NULL)
@@ -366,6 +425,13 @@ void map_update_tile_pointers()
 	}
 
 	gNextFreeMapElement = mapElement;
+	footpath_invalidate_map_edge_connectivity();
+	map_invalidate_all_path_wide_flags();
+	map_invalidate_all_tile_element_types();
+	window_map_invalidate_all_tiles();
+	viewport_interaction_cache_invalidate();
+	ride_track_registry_invalidate();
+	park_invalidate_statistics();
 }
 
 /**
@@ -592,6 +658,41 @@ int map_coord_is_connected(int x, int y, int z, uint8 faceDirection)
 	return 0;
 }
 
+static uint32 _pathWideFlagsDirtyTiles[256][256 / 32];
+static bool _pathWideFlagsDirty = false;
+
+static void map_mark_path_wide_flags_dirty(int x, int y)
+{
+	if (x >= 0 && y >= 0 && x < 256 && y < 256) {
+		_pathWideFlagsDirtyTiles[y][x / 32] |= 1u << (x & 31);
+	}
+}
+
+/**
+ * Queues the wide flags of the paths around a tile to be recalculated. Must be called whenever a path is
+ * added, removed or has its edges changed.
+ *  x, y: coordinates in units (not tiles)
+ */
+void map_invalidate_path_wide_flags(int x, int y)
+{
+	x /= 32;
+	y /= 32;
+
+	// Edge changes can spread to the neighbouring paths and each tile looks at the tiles around it
+	for (int yy = y - 2; yy <= y + 2; yy++) {
+		for (int xx = x - 2; xx <= x + 2; xx++) {
+			map_mark_path_wide_flags_dirty(xx, yy);
+		}
+	}
+	_pathWideFlagsDirty = true;
+}
+
+void map_invalidate_all_path_wide_flags()
+{
+	memset(_pathWideFlagsDirtyTiles, 0xFF, sizeof(_pathWideFlagsDirtyTiles));
+	_pathWideFlagsDirty = true;
+}
+
 /**
  *
  *  rct2: 0x006A876D
@@ -601,27 +702,35 @@ void map_update_path_wide_flags()
 	if (gScreenFlags & (SCREEN_FLAGS_TRACK_DESIGNER | SCREEN_FLAGS_TRACK_MANAGER)) {
 		return;
 	}
+	if (!_pathWideFlagsDirty) {
+		return;
+	}
+	_pathWideFlagsDirty = false;
 
-	// Presumebly update_path_wide_flags is too computationally expensive to call for every
-	// tile every update, so gWidePathTileLoopX and gWidePathTileLoopY store the x and y
-	// progress. A maximum of 128 calls is done per update.
-	uint16 x = gWidePathTileLoopX;
-	uint16 y = gWidePathTileLoopY;
-	for (int i = 0; i < 128; i++) {
-		footpath_update_path_wide_flags(x, y);
+	// Only tiles near a footpath change are updated. They are visited in the same order the original sweep of
+	// the whole map used, a tile depends on the tiles before it so a change is passed on to the tiles after it.
+	for (int y = 0; y < 256; y++) {
+		for (int x = 0; x < 256; x++) {
+			uint32 *dirtyTiles = &_pathWideFlagsDirtyTiles[y][x / 32];
+			if (*dirtyTiles == 0) {
+				x |= 31;
+				continue;
+			}
 
-		// Next x, y tile
-		x += 32;
-		if (x >= 8192) {
-			x = 0;
-			y += 32;
-			if (y >= 8192) {
-				y = 0;
+			uint32 bit = 1u << (x & 31);
+			if (!(*dirtyTiles & bit)) {
+				continue;
+			}
+			*dirtyTiles &= ~bit;
+
+			if (footpath_update_path_wide_flags(x * 32, y * 32)) {
+				map_mark_path_wide_flags_dirty(x + 1, y);
+				map_mark_path_wide_flags_dirty(x - 1, y + 1);
+				map_mark_path_wide_flags_dirty(x, y + 1);
+				map_mark_path_wide_flags_dirty(x + 1, y + 1);
 			}
 		}
 	}
-	gWidePathTileLoopX = x;
-	gWidePathTileLoopY = y;
 }
 
 /**
@@ -3773,17 +3882,20 @@ int map_get_station(rct_map_element *mapElement)
  */
 void map_element_remove(rct_map_element *mapElement)
 {
+	rct_map_element *removedElement = mapElement;
 	if (!map_element_is_last_for_tile(mapElement)){
 		do{
 			*mapElement = *(mapElement + 1);
 		} while (!map_element_is_last_for_tile(++mapElement));
 	}
+	viewport_interaction_cache_invalidate_elements(removedElement, mapElement);
 	(mapElement - 1)->flags |= MAP_ELEMENT_FLAG_LAST_TILE;
 	mapElement->base_height = 0xFF;
 
 	if ((mapElement + 1) == gNextFreeMapElement){
 		gNextFreeMapElement--;
 	}
+	footpath_invalidate_map_edge_connectivity();
 }
 
 /**
@@ -3966,15 +4078,25 @@ int sub_68B044()
  */
 rct_map_element *map_element_insert(int x, int y, int z, int flags)
 {
-	rct_map_element *originalMapElement, *newMapElement, *insertedElement;
+	rct_map_element *originalMapElement, *newMapElement, *insertedElement, *movedMapElements;
 
 	if (!sub_68B044()) {
 		log_error("Cannot insert new element");
 		return NULL;
 	}
 
+	footpath_invalidate_map_edge_connectivity();
+
+	// The previous inserted element has its type by now, the new one does not yet
+	if (_tileElementTypesPendingTile != -1) {
+		_tileElementTypes[_tileElementTypesPendingTile] = 0;
+	}
+	_tileElementTypesPendingTile = x + y * 256;
+	map_invalidate_tile_element_types(x, y);
+
 	newMapElement = gNextFreeMapElement;
 	originalMapElement = TILE_MAP_ELEMENT_POINTER(y * 256 + x);
+	movedMapElements = originalMapElement;
 
 	// Set tile index pointer to point to new element block
 	TILE_MAP_ELEMENT_POINTER(y * 256 + x) = newMapElement;
@@ -4014,6 +4136,8 @@ rct_map_element *map_element_insert(int x, int y, int z, int flags)
 		} while (!((newMapElement - 1)->flags & MAP_ELEMENT_FLAG_LAST_TILE));
 	}
 
+	viewport_interaction_cache_invalidate_elements(movedMapElements, originalMapElement - 1);
+
 	gNextFreeMapElement = newMapElement;
 	return insertedElement;
 }
@@ -4413,7 +4537,7 @@ void map_extend_boundary_surface()
 		newMapElement->properties.surface.slope = existingMapElement->properties.surface.slope & 0xE0;
 		newMapElement->properties.surface.terrain = existingMapElement->properties.surface.terrain;
 		newMapElement->properties.surface.grass_length = existingMapElement->properties.surface.grass_length;
-		newMapElement->properties.surface.ownership = 0;
+		park_set_surface_ownership(newMapElement, 0);
 
 		z = existingMapElement->base_height;
 		slope = existingMapElement->properties.surface.slope & 9;
@@ -4449,7 +4573,7 @@ void map_extend_boundary_surface()
 		newMapElement->properties.surface.slope = existingMapElement->properties.surface.slope & 0xE0;
 		newMapElement->properties.surface.terrain = existingMapElement->properties.surface.terrain;
 		newMapElement->properties.surface.grass_length = existingMapElement->properties.surface.grass_length;
-		newMapElement->properties.surface.ownership = 0;
+		park_set_surface_ownership(newMapElement, 0);
 
 		z = existingMapElement->base_height;
 		slope = existingMapElement->properties.surface.slope & 3;
@@ -4500,7 +4624,7 @@ static void clear_elements_at(int x, int y)
 			mapElement->properties.surface.slope = 0;
 			mapElement->properties.surface.terrain = 0;
 			mapElement->properties.surface.grass_length = 1;
-			mapElement->properties.surface.ownership = 0;
+			park_set_surface_ownership(mapElement, 0);
 			if (!map_element_is_last_for_tile(mapElement++))
 				goto next_element;
 
@@ -4584,6 +4708,9 @@ bool map_element_is_underground(rct_map_element *mapElement)
 
 rct_map_element *map_get_large_scenery_segment(int x, int y, int z, int direction, int sequence)
 {
+	if (!map_tile_may_contain_element_type(x >> 5, y >> 5, MAP_ELEMENT_TYPE_SCENERY_MULTIPLE))
+		return NULL;
+
 	rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
 	if (mapElement == NULL)
 	{
@@ -4606,6 +4733,9 @@ rct_map_element *map_get_large_scenery_segment(int x, int y, int z, int directio
 
 rct_map_element *map_get_fence_element_at(int x, int y, int z, int direction)
 {
+	if (!map_tile_may_contain_element_type(x >> 5, y >> 5, MAP_ELEMENT_TYPE_FENCE))
+		return NULL;
+
 	rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
 	do {
 		if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_FENCE)
@@ -4622,6 +4752,9 @@ rct_map_element *map_get_fence_element_at(int x, int y, int z, int direction)
 
 rct_map_element *map_get_small_scenery_element_at(int x, int y, int z, int type, uint8 quadrant)
 {
+	if (!map_tile_may_contain_element_type(x >> 5, y >> 5, MAP_ELEMENT_TYPE_SCENERY))
+		return NULL;
+
 	rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
 	do {
 		if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_SCENERY)
@@ -4775,7 +4908,7 @@ static void translate_3d_to_2d(int rotation, int *x, int *y)
 
 void map_invalidate_tile_under_zoom(int x, int y, int z0, int z1, int maxZoom)
 {
-	if (gOpenRCT2Headless) return;
+	window_map_invalidate_tile(x >> 5, y >> 5);
 
 	int x1, y1, x2, y2;
 
@@ -4788,6 +4921,10 @@ void map_invalidate_tile_under_zoom(int x, int y, int z0, int z1, int maxZoom)
 	x2 = x + 32;
 	y2 = y + 32 - z0;
 
+	viewport_interaction_cache_invalidate_rect(x1, y1, x2, y2);
+
+	if (gOpenRCT2Headless) return;
+
 	for (int i = 0; i < MAX_VIEWPORT_COUNT; i++) {
 		rct_viewport *viewport = &g_viewport_list[i];
 		if (viewport->width != 0 && (maxZoom == -1 || viewport->zoom <= maxZoom)) {
@@ -4960,7 +5097,7 @@ money32 place_park_entrance(int flags, sint16 x, sint16 y, sint16 z, uint8 direc
 
 		if (!(flags & GAME_COMMAND_FLAG_GHOST)) {
 			rct_map_element* surfaceElement = map_get_surface_element_at(x / 32, y / 32);
-			surfaceElement->properties.surface.ownership = 0;
+			park_set_surface_ownership(surfaceElement, 0);
 		}
 
 		rct_map_element* newElement = map_element_insert(x / 32, y / 32, zLow, 0xF);
@@ -5005,7 +5142,7 @@ money32 place_park_entrance(int flags, sint16 x, sint16 y, sint16 z, uint8 direc
 
 		if (!(flags & GAME_COMMAND_FLAG_GHOST)) {
 			rct_map_element* surfaceElement = map_get_surface_element_at(x / 32, y / 32);
-			surfaceElement->properties.surface.ownership = 0;
+			park_set_surface_ownership(surfaceElement, 0);
 		}
 
 		rct_map_element* newElement = map_element_insert(x / 32, y / 32, zLow, 0xF);
@@ -5043,7 +5180,7 @@ money32 place_park_entrance(int flags, sint16 x, sint16 y, sint16 z, uint8 direc
 
 		if (!(flags & GAME_COMMAND_FLAG_GHOST)) {
 			rct_map_element* surfaceElement = map_get_surface_element_at(x / 32, y / 32);
-			surfaceElement->properties.surface.ownership = 0;
+			park_set_surface_ownership(surfaceElement, 0);
 		}
 
 		rct_map_element* newElement = map_element_insert(x / 32, y / 32, zLow, 0xF);
@@ -5255,6 +5392,7 @@ void game_command_set_banner_style(int* eax, int* ebx, int* ecx, int* edx, int*
 	if (banner->flags & BANNER_FLAG_NO_ENTRY){
 		map_element->properties.banner.flags &= ~(1 << map_element->properties.banner.position);
 	}
+	footpath_invalidate_map_edge_connectivity();
 
 	int colourCodepoint = FORMAT_COLOUR_CODE_START + banner->text_colour;
 
@@ -5371,6 +5509,9 @@ void game_command_set_sign_style(int* eax, int* ebx, int* ecx, int* edx, int* es
  */
 rct_map_element *map_get_track_element_at(int x, int y, int z)
 {
+	if (!map_tile_may_contain_element_type(x >> 5, y >> 5, MAP_ELEMENT_TYPE_TRACK))
+		return NULL;
+
 	rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
 	do {
 		if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK) continue;
@@ -5391,6 +5532,9 @@ rct_map_element *map_get_track_element_at(int x, int y, int z)
  */
 rct_map_element *map_get_track_element_at_of_type(int x, int y, int z, int trackType)
 {
+	if (!map_tile_may_contain_element_type(x >> 5, y >> 5, MAP_ELEMENT_TYPE_TRACK))
+		return NULL;
+
 	rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
 	do {
 		if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK) continue;
@@ -5413,6 +5557,9 @@ rct_map_element *map_get_track_element_at_of_type(int x, int y, int z, int track
  */
 rct_map_element *map_get_track_element_at_of_type_seq(int x, int y, int z, int trackType, int sequence)
 {
+	if (!map_tile_may_contain_element_type(x >> 5, y >> 5, MAP_ELEMENT_TYPE_TRACK))
+		return NULL;
+
 	rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
 	do {
 		if (mapElement == NULL) break;
@@ -5436,6 +5583,9 @@ rct_map_element *map_get_track_element_at_of_type_seq(int x, int y, int z, int t
  * @param ride index
  */
 rct_map_element *map_get_track_element_at_of_type_from_ride(int x, int y, int z, int trackType, int rideIndex) {
+	if (!map_tile_may_contain_element_type(x >> 5, y >> 5, MAP_ELEMENT_TYPE_TRACK))
+		return NULL;
+
 	rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
 	do {
 		if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK) continue;
@@ -5457,6 +5607,9 @@ rct_map_element *map_get_track_element_at_of_type_from_ride(int x, int y, int z,
  * @param ride index
  */
 rct_map_element *map_get_track_element_at_from_ride(int x, int y, int z, int rideIndex) {
+	if (!map_tile_may_contain_element_type(x >> 5, y >> 5, MAP_ELEMENT_TYPE_TRACK))
+		return NULL;
+
 	rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
 	do {
 		if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK) continue;
@@ -5479,6 +5632,9 @@ rct_map_element *map_get_track_element_at_from_ride(int x, int y, int z, int rid
  */
 rct_map_element *map_get_track_element_at_with_direction_from_ride(int x, int y, int z, int direction, int rideIndex)
 {
+	if (!map_tile_may_contain_element_type(x >> 5, y >> 5, MAP_ELEMENT_TYPE_TRACK))
+		return NULL;
+
 	rct_map_element *mapElement = map_get_first_element_at(x >> 5, y >> 5);
 	do {
 		if (map_element_get_type(mapElement) != MAP_ELEMENT_TYPE_TRACK) continue;
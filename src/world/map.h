@@ -308,6 +308,7 @@ extern rct_xyz16 gCommandPosition;
 void map_init(int size);
 void map_update_tile_pointers();
 rct_map_element *map_get_first_element_at(int x, int y);
+void map_invalidate_all_tile_element_types();
 void map_set_tile_elements(int x, int y, rct_map_element *elements);
 int map_element_is_last_for_tile(const rct_map_element *element);
 int map_element_get_type(const rct_map_element *element);
@@ -326,6 +327,8 @@ int map_element_height(int x, int y);
 void sub_68B089();
 int map_coord_is_connected(int x, int y, int z, uint8 faceDirection);
 void map_update_path_wide_flags();
+void map_invalidate_path_wide_flags(int x, int y);
+void map_invalidate_all_path_wide_flags();
 bool map_is_location_valid(int x, int y);
 bool map_is_location_owned(int x, int y, int z);
 bool map_is_location_in_park(int x, int y);
@@ -64,6 +64,40 @@ rct_xyz16 gParkEntranceGhostPosition;
 uint8 gParkEntranceGhostDirection;
 money32 gParkEntranceGhostPrice;
 
+/**
+ * Number of surface elements with land or construction rights owned. Kept up to date by park_set_surface_ownership and
+ * recounted from the map after park_invalidate_statistics.
+ */
+static int _parkSizeTiles;
+static bool _parkSizeValid = false;
+
+/**
+ * The ride figures that go into the park rating, either for a single ride or summed over all rides.
+ */
+typedef struct park_ride_rating_inputs {
+	int num_rides;
+	int num_exciting_rides;
+	int uptime;
+	int excitement;
+	int intensity;
+} park_ride_rating_inputs;
+
+/**
+ * What each ride last contributed to the park rating and the running totals of those contributions. Kept up to date by
+ * park_update_ride_rating_inputs and recounted from the rides after park_invalidate_statistics.
+ */
+static park_ride_rating_inputs _parkRideRatingInputs[MAX_RIDES];
+static park_ride_rating_inputs _parkRideRatingTotals;
+
+/**
+ * Litter is left out of the park rating on the tick it was dropped, so the number of litter sprites created on
+ * _parkRecentLitterTick that still exist is kept to be taken off the litter sprite count.
+ */
+static uint32 _parkRecentLitterTick;
+static int _parkRecentLitterCount;
+
+static bool _parkRatingInputsValid = false;
+
 int park_is_open()
 {
 	return (gParkFlags & PARK_FLAGS_PARK_OPEN) != 0;
@@ -149,11 +183,7 @@ void park_reset_history()
 	}
 }
 
-/**
- *
- *  rct2: 0x0066A348
- */
-int park_calculate_size()
+static int park_count_owned_tiles()
 {
 	int tiles;
 	map_element_iterator it;
@@ -167,6 +197,55 @@ int park_calculate_size()
 			}
 		}
 	} while (map_element_iterator_next(&it));
+	return tiles;
+}
+
+/**
+ * Makes the next park_calculate_size and calculate_park_rating recount their inputs, for when the map, rides or
+ * sprites have been replaced or rebuilt wholesale.
+ */
+void park_invalidate_statistics()
+{
+	_parkSizeValid = false;
+	_parkRatingInputsValid = false;
+}
+
+/**
+ * Sets the ownership of a surface element. All changes to ownership after the map is loaded must go through here so
+ * the owned tile count stays correct.
+ */
+void park_set_surface_ownership(rct_map_element *surfaceElement, uint8 ownership)
+{
+	if (_parkSizeValid) {
+		bool wasOwned = (surfaceElement->properties.surface.ownership & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED)) != 0;
+		bool isOwned = (ownership & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED)) != 0;
+		_parkSizeTiles += (int)isOwned - (int)wasOwned;
+	}
+	surfaceElement->properties.surface.ownership = ownership;
+}
+
+/**
+ *
+ *  rct2: 0x0066A348
+ */
+int park_calculate_size()
+{
+	int tiles;
+
+	if (!_parkSizeValid) {
+		_parkSizeTiles = park_count_owned_tiles();
+		_parkSizeValid = true;
+	}
+#if DEBUG_LEVEL_1
+	else {
+		tiles = park_count_owned_tiles();
+		if (tiles != _parkSizeTiles) {
+			log_error("Owned tile count out of sync, counted %d but expected %d.", tiles, _parkSizeTiles);
+			_parkSizeTiles = tiles;
+		}
+	}
+#endif
+	tiles = _parkSizeTiles;
 
 	if (tiles != gParkSize) {
 		gParkSize = tiles;
@@ -176,6 +255,131 @@ int park_calculate_size()
 	return tiles;
 }
 
+static void park_get_ride_rating_inputs(rct_ride *ride, park_ride_rating_inputs *inputs)
+{
+	memset(inputs, 0, sizeof(park_ride_rating_inputs));
+	if (ride->type == RIDE_TYPE_NULL)
+		return;
+
+	inputs->num_rides = 1;
+	inputs->uptime = 100 - ride->downtime;
+	if (ride->excitement != -1) {
+		inputs->num_exciting_rides = 1;
+		inputs->excitement = ride->excitement / 8;
+		inputs->intensity = ride->intensity / 8;
+	}
+}
+
+static void park_add_ride_rating_inputs(park_ride_rating_inputs *totals, const park_ride_rating_inputs *inputs, int sign)
+{
+	totals->num_rides += sign * inputs->num_rides;
+	totals->num_exciting_rides += sign * inputs->num_exciting_rides;
+	totals->uptime += sign * inputs->uptime;
+	totals->excitement += sign * inputs->excitement;
+	totals->intensity += sign * inputs->intensity;
+}
+
+static void park_count_ride_rating_inputs(park_ride_rating_inputs *rideInputs, park_ride_rating_inputs *totals)
+{
+	memset(totals, 0, sizeof(park_ride_rating_inputs));
+	for (int i = 0; i < MAX_RIDES; i++) {
+		park_get_ride_rating_inputs(get_ride(i), &rideInputs[i]);
+		park_add_ride_rating_inputs(totals, &rideInputs[i], 1);
+	}
+}
+
+/**
+ * Counts the litter that is too recent to count towards the park rating.
+ */
+static int park_count_recent_litter()
+{
+	rct_litter *litter;
+	uint16 spriteIndex;
+	int count;
+
+	count = 0;
+	for (spriteIndex = gSpriteListHead[SPRITE_LIST_LITTER]; spriteIndex != SPRITE_INDEX_NULL; spriteIndex = litter->next) {
+		litter = &(g_sprite_list[spriteIndex].litter);
+		if (litter->creationTick - gScenarioTicks < 7680)
+			count++;
+	}
+	return count;
+}
+
+static void park_count_rating_inputs()
+{
+	park_count_ride_rating_inputs(_parkRideRatingInputs, &_parkRideRatingTotals);
+	_parkRecentLitterTick = gScenarioTicks;
+	_parkRecentLitterCount = park_count_recent_litter();
+	_parkRatingInputsValid = true;
+}
+
+#if DEBUG_LEVEL_1
+static void park_verify_rating_inputs()
+{
+	park_ride_rating_inputs rideInputs[MAX_RIDES];
+	park_ride_rating_inputs totals;
+	int recentLitter, expectedRecentLitter;
+
+	park_count_ride_rating_inputs(rideInputs, &totals);
+	recentLitter = park_count_recent_litter();
+	expectedRecentLitter = _parkRecentLitterTick == gScenarioTicks ? _parkRecentLitterCount : 0;
+
+	if (memcmp(rideInputs, _parkRideRatingInputs, sizeof(rideInputs)) != 0 ||
+		memcmp(&totals, &_parkRideRatingTotals, sizeof(totals)) != 0
+	) {
+		log_error("Ride rating inputs out of sync, counted %d rides (%d rated) but expected %d (%d rated).",
+			totals.num_rides, totals.num_exciting_rides, _parkRideRatingTotals.num_rides, _parkRideRatingTotals.num_exciting_rides);
+		park_count_rating_inputs();
+	} else if (recentLitter != expectedRecentLitter) {
+		log_error("Recent litter count out of sync, counted %d but expected %d.", recentLitter, expectedRecentLitter);
+		park_count_rating_inputs();
+	}
+}
+#endif
+
+/**
+ * Updates the park rating inputs after a ride has been created, deleted or had its ratings or downtime changed.
+ */
+void park_update_ride_rating_inputs(int rideIndex)
+{
+	if (!_parkRatingInputsValid)
+		return;
+
+	park_ride_rating_inputs *inputs = &_parkRideRatingInputs[rideIndex];
+	park_add_ride_rating_inputs(&_parkRideRatingTotals, inputs, -1);
+	park_get_ride_rating_inputs(get_ride(rideIndex), inputs);
+	park_add_ride_rating_inputs(&_parkRideRatingTotals, inputs, 1);
+}
+
+/**
+ * Called when litter is dropped, creationTick is the tick it was dropped on.
+ */
+void park_litter_created(uint32 creationTick)
+{
+	if (!_parkRatingInputsValid)
+		return;
+
+	if (_parkRecentLitterTick != creationTick) {
+		_parkRecentLitterTick = creationTick;
+		_parkRecentLitterCount = 0;
+	}
+	_parkRecentLitterCount++;
+}
+
+/**
+ * Called when litter is removed, creationTick is the tick it was dropped on.
+ */
+void park_litter_removed(uint32 creationTick)
+{
+	if (!_parkRatingInputsValid)
+		return;
+
+	if (_parkRecentLitterTick == creationTick && _parkRecentLitterCount > 0) {
+		_parkRecentLitterCount--;
+	}
+}
+
 /**
  *
  *  rct2: 0x00669EAA
@@ -187,6 +391,15 @@ int calculate_park_rating()
 
 	int result;
 
+	if (!_parkRatingInputsValid) {
+		park_count_rating_inputs();
+	}
+#if DEBUG_LEVEL_1
+	else {
+		park_verify_rating_inputs();
+	}
+#endif
+
 	result = 1150;
 	if (gParkFlags & PARK_FLAGS_DIFFICULT_PARK_RATING)
 		result = 1050;
@@ -226,22 +439,16 @@ int calculate_park_rating()
 
 	// Rides
 	{
-		int i;
-		short total_ride_uptime = 0, total_ride_intensity = 0, total_ride_excitement = 0, average_intensity, average_excitement;
-		int num_rides, num_exciting_rides = 0;
-		rct_ride* ride;
+		short total_ride_uptime, total_ride_intensity, total_ride_excitement, average_intensity, average_excitement;
+		int num_rides, num_exciting_rides;
 
-		num_rides = 0;
-		FOR_ALL_RIDES(i, ride) {
-			total_ride_uptime += 100 - ride->downtime;
+		// The totals were summed as shorts, truncating keeps any overflow the same
+		total_ride_uptime = (short)_parkRideRatingTotals.uptime;
+		total_ride_excitement = (short)_parkRideRatingTotals.excitement;
+		total_ride_intensity = (short)_parkRideRatingTotals.intensity;
+		num_rides = _parkRideRatingTotals.num_rides;
+		num_exciting_rides = _parkRideRatingTotals.num_exciting_rides;
 
-			if (ride->excitement != -1){
-				total_ride_excitement += ride->excitement / 8;
-				total_ride_intensity += ride->intensity / 8;
-				num_exciting_rides++;
-			}
-			num_rides++;
-		}
 		result -= 200;
 		if (num_rides > 0)
 			result += (total_ride_uptime / num_rides) * 2;
@@ -274,18 +481,12 @@ int calculate_park_rating()
 
 	// Litter
 	{
-		rct_litter* litter;
-		uint16 sprite_idx;
 		short num_litter;
 
-		num_litter = 0;
-		for (sprite_idx = gSpriteListHead[SPRITE_LIST_LITTER]; sprite_idx != SPRITE_INDEX_NULL; sprite_idx = litter->next) {
-			litter = &(g_sprite_list[sprite_idx].litter);
-
-			// Ignore recently dropped litter
-			if (litter->creationTick - gScenarioTicks >= 7680)
-				num_litter++;
-		}
+		// Ignore recently dropped litter
+		num_litter = gSpriteListCount[SPRITE_LIST_LITTER];
+		if (_parkRecentLitterTick == gScenarioTicks)
+			num_litter -= _parkRecentLitterCount;
 		result -= 600 - (4 * (150 - min(150, num_litter)));
 	}
 
@@ -795,7 +996,7 @@ void update_park_fences(int x, int y)
 		int z0 = sufaceElement->base_height * 8;
 		int z1 = z0 + 16;
 		map_invalidate_tile(x, y, z0, z1);
-		sufaceElement->properties.surface.ownership = newOwnership;
+		park_set_surface_ownership(sufaceElement, newOwnership);
 	}
 }
 
@@ -960,7 +1161,7 @@ money32 map_buy_land_rights_for_tile(int x, int y, int setting, int flags) {
 			return MONEY32_UNDEFINED;
 		}
 		if (flags & GAME_COMMAND_FLAG_APPLY) {
-			surfaceElement->properties.surface.ownership |= OWNERSHIP_OWNED;
+			park_set_surface_ownership(surfaceElement, surfaceElement->properties.surface.ownership | OWNERSHIP_OWNED);
 			update_park_fences(x, y);
 			update_park_fences(x - 32, y);
 			update_park_fences(x + 32, y);
@@ -970,7 +1171,7 @@ money32 map_buy_land_rights_for_tile(int x, int y, int setting, int flags) {
 		return gLandPrice;
 	case 1:
 		if (flags & GAME_COMMAND_FLAG_APPLY) {
-			surfaceElement->properties.surface.ownership &= ~(OWNERSHIP_OWNED | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
+			park_set_surface_ownership(surfaceElement, surfaceElement->properties.surface.ownership & ~(OWNERSHIP_OWNED | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED));
 			update_park_fences(x, y);
 			update_park_fences(x - 32, y);
 			update_park_fences(x + 32, y);
@@ -989,28 +1190,28 @@ money32 map_buy_land_rights_for_tile(int x, int y, int setting, int flags) {
 		}
 
 		if (flags & GAME_COMMAND_FLAG_APPLY) {
-			surfaceElement->properties.surface.ownership |= OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED;
+			park_set_surface_ownership(surfaceElement, surfaceElement->properties.surface.ownership | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
 			uint16 baseHeight = surfaceElement->base_height * 8;
 			map_invalidate_tile(x, y, baseHeight, baseHeight + 16);
 		}
 		return gConstructionRightsPrice;
 	case 3:
 		if (flags & GAME_COMMAND_FLAG_APPLY) {
-			surfaceElement->properties.surface.ownership &= ~OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED;
+			park_set_surface_ownership(surfaceElement, surfaceElement->properties.surface.ownership & ~OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
 			uint16 baseHeight = surfaceElement->base_height * 8;
 			map_invalidate_tile(x, y, baseHeight, baseHeight + 16);
 		}
 		return 0;
 	case 4:
 		if (flags & GAME_COMMAND_FLAG_APPLY) {
-			surfaceElement->properties.surface.ownership |= OWNERSHIP_AVAILABLE;
+			park_set_surface_ownership(surfaceElement, surfaceElement->properties.surface.ownership | OWNERSHIP_AVAILABLE);
 			uint16 baseHeight = surfaceElement->base_height * 8;
 			map_invalidate_tile(x, y, baseHeight, baseHeight + 16);
 		}
 		return 0;
 	case 5:
 		if (flags & GAME_COMMAND_FLAG_APPLY) {
-			surfaceElement->properties.surface.ownership |= OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE;
+			park_set_surface_ownership(surfaceElement, surfaceElement->properties.surface.ownership | OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE);
 			uint16 baseHeight = surfaceElement->base_height * 8;
 			map_invalidate_tile(x, y, baseHeight, baseHeight + 16);
 		}
@@ -1057,8 +1258,7 @@ money32 map_buy_land_rights_for_tile(int x, int y, int setting, int flags) {
 				}
 			}
 		}
-		surfaceElement->properties.surface.ownership &= 0x0F;
-		surfaceElement->properties.surface.ownership |= newOwnership;
+		park_set_surface_ownership(surfaceElement, (surfaceElement->properties.surface.ownership & 0x0F) | newOwnership);
 		update_park_fences(x, y);
 		update_park_fences(x - 32, y);
 		update_park_fences(x + 32, y);
@@ -82,8 +82,13 @@ int park_is_open();
 void park_init();
 void park_reset_history();
 int park_calculate_size();
+void park_invalidate_statistics();
+void park_set_surface_ownership(rct_map_element *surfaceElement, uint8 ownership);
 
 int calculate_park_rating();
+void park_update_ride_rating_inputs(int rideIndex);
+void park_litter_created(uint32 creationTick);
+void park_litter_removed(uint32 creationTick);
 money32 calculate_park_value();
 money32 calculate_company_value();
 void reset_park_entrances();
@@ -20,8 +20,10 @@
 #include "../interface/viewport.h"
 #include "../localisation/date.h"
 #include "../localisation/localisation.h"
+#include "../peep/staff.h"
 #include "../scenario.h"
 #include "fountain.h"
+#include "park.h"
 #include "sprite.h"
 
 rct_sprite* g_sprite_list = RCT2_ADDRESS(RCT2_ADDRESS_SPRITE_LIST, rct_sprite);
@@ -37,22 +39,151 @@ uint16 sprite_get_first_in_quadrant(int x, int y)
 	return RCT2_ADDRESS(0x00F1EF60, uint16)[offset];
 }
 
+// Sprite invalidations are queued in view coordinates and marked dirty in every viewport in one go before drawing
+#define MAX_QUEUED_SPRITE_INVALIDATIONS 4096
+#define SPRITE_INVALIDATION_MERGE_DISTANCE 8
+
+typedef struct sprite_invalidation {
+	sint16 left, top, right, bottom;
+	uint8 max_zoom;
+} sprite_invalidation;
+
+static sprite_invalidation _queuedSpriteInvalidations[MAX_QUEUED_SPRITE_INVALIDATIONS];
+static int _numQueuedSpriteInvalidations;
+
+bool gSpriteInvalidationStatsEnabled;
+sprite_invalidation_stats gSpriteInvalidationStats;
+static sprite_invalidation_stats _currentSpriteInvalidationStats;
+
+static int sprite_invalidation_get_area(int left, int top, int right, int bottom)
+{
+	return (right - left) * (bottom - top);
+}
+
+/**
+ * Merges the rectangle into one of the most recently queued rectangles if their union is no larger than the two
+ * rectangles on their own. A moving sprite is usually invalidated at its old and new position one after the other.
+ */
+static bool sprite_invalidation_try_merge(sint16 left, sint16 top, sint16 right, sint16 bottom, uint8 maxZoom)
+{
+	int end = _numQueuedSpriteInvalidations - SPRITE_INVALIDATION_MERGE_DISTANCE;
+	for (int i = _numQueuedSpriteInvalidations - 1; i >= 0 && i >= end; i--) {
+		sprite_invalidation *invalidation = &_queuedSpriteInvalidations[i];
+		if (invalidation->max_zoom != maxZoom)
+			continue;
+
+		int unionLeft = min(invalidation->left, left);
+		int unionTop = min(invalidation->top, top);
+		int unionRight = max(invalidation->right, right);
+		int unionBottom = max(invalidation->bottom, bottom);
+		int unionArea = sprite_invalidation_get_area(unionLeft, unionTop, unionRight, unionBottom);
+		int separateArea =
+			sprite_invalidation_get_area(invalidation->left, invalidation->top, invalidation->right, invalidation->bottom) +
+			sprite_invalidation_get_area(left, top, right, bottom);
+		if (unionArea > separateArea)
+			continue;
+
+		invalidation->left = unionLeft;
+		invalidation->top = unionTop;
+		invalidation->right = unionRight;
+		invalidation->bottom = unionBottom;
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Discards cached hit test results under the current screen bounds of a sprite.
+ */
+static void sprite_invalidate_interaction_cache(rct_sprite *sprite)
+{
+	if (sprite->unknown.sprite_left == SPRITE_LOCATION_NULL) return;
+
+	viewport_interaction_cache_invalidate_rect(
+		sprite->unknown.sprite_left,
+		sprite->unknown.sprite_top,
+		sprite->unknown.sprite_right,
+		sprite->unknown.sprite_bottom
+	);
+}
+
 static void invalidate_sprite_max_zoom(rct_sprite *sprite, int maxZoom)
 {
 	if (sprite->unknown.sprite_left == SPRITE_LOCATION_NULL) return;
 
+	sint16 left = sprite->unknown.sprite_left;
+	sint16 top = sprite->unknown.sprite_top;
+	sint16 right = sprite->unknown.sprite_right;
+	sint16 bottom = sprite->unknown.sprite_bottom;
+
+	viewport_interaction_cache_invalidate_rect(left, top, right, bottom);
+
+	if (gSpriteInvalidationStatsEnabled) {
+		_currentSpriteInvalidationStats.queued++;
+		for (int i = 0; i < MAX_VIEWPORT_COUNT; i++) {
+			rct_viewport *viewport = &g_viewport_list[i];
+			if (viewport->width != 0 && viewport->zoom <= maxZoom) {
+				_currentSpriteInvalidationStats.blocks_before += viewport_get_invalidate_block_count(viewport, left, top, right, bottom);
+			}
+		}
+	}
+
+	if (sprite_invalidation_try_merge(left, top, right, bottom, maxZoom))
+		return;
+
+	if (_numQueuedSpriteInvalidations >= MAX_QUEUED_SPRITE_INVALIDATIONS) {
+		sprite_flush_invalidations();
+	}
+
+	sprite_invalidation *invalidation = &_queuedSpriteInvalidations[_numQueuedSpriteInvalidations++];
+	invalidation->left = left;
+	invalidation->top = top;
+	invalidation->right = right;
+	invalidation->bottom = bottom;
+	invalidation->max_zoom = maxZoom;
+}
+
+/**
+ * Marks the queued sprite invalidations as dirty in every viewport that shows them.
+ */
+void sprite_flush_invalidations()
+{
 	for (int i = 0; i < MAX_VIEWPORT_COUNT; i++) {
 		rct_viewport *viewport = &g_viewport_list[i];
-		if (viewport->width != 0 && viewport->zoom <= maxZoom) {
-			viewport_invalidate(
-				viewport,
-				sprite->unknown.sprite_left,
-				sprite->unknown.sprite_top,
-				sprite->unknown.sprite_right,
-				sprite->unknown.sprite_bottom
-			);
+		if (viewport->width == 0)
+			continue;
+
+		for (int j = 0; j < _numQueuedSpriteInvalidations; j++) {
+			sprite_invalidation *invalidation = &_queuedSpriteInvalidations[j];
+			if (viewport->zoom > invalidation->max_zoom)
+				continue;
+
+			if (gSpriteInvalidationStatsEnabled) {
+				_currentSpriteInvalidationStats.blocks_after += viewport_get_invalidate_block_count(
+					viewport,
+					invalidation->left,
+					invalidation->top,
+					invalidation->right,
+					invalidation->bottom
+				);
+			}
+			viewport_invalidate(viewport, invalidation->left, invalidation->top, invalidation->right, invalidation->bottom);
 		}
 	}
+
+	if (gSpriteInvalidationStatsEnabled) {
+		_currentSpriteInvalidationStats.flushed += _numQueuedSpriteInvalidations;
+	}
+	_numQueuedSpriteInvalidations = 0;
+}
+
+/**
+ * Publishes the invalidation counters gathered since the last frame to gSpriteInvalidationStats.
+ */
+void sprite_invalidation_stats_end_frame()
+{
+	gSpriteInvalidationStats = _currentSpriteInvalidationStats;
+	memset(&_currentSpriteInvalidationStats, 0, sizeof(sprite_invalidation_stats));
 }
 
 /**
@@ -97,6 +228,7 @@ void reset_sprite_list()
 		gSpriteListHead[i] = SPRITE_INDEX_NULL;
 		gSpriteListCount[i] = 0;
 	}
+	park_invalidate_statistics();
 
 	rct_sprite* previous_spr = (rct_sprite*)SPRITE_INDEX_NULL;
 
@@ -122,6 +254,8 @@ void reset_sprite_list()
 	gSpriteListCount[SPRITE_LIST_NULL] = MAX_SPRITES;
 
 	reset_0x69EBE4();
+	staff_invalidate_mechanic_list();
+	staff_invalidate_greyed_patrol_areas();
 }
 
 /**
@@ -152,6 +286,8 @@ void reset_0x69EBE4()
 			spr->unknown.next_in_quadrant = ax;
 		}
 	}
+	staff_invalidate_mechanic_list();
+	staff_invalidate_greyed_patrol_areas();
 }
 
 /**
@@ -235,6 +371,11 @@ void move_sprite_to_list(rct_sprite *sprite, uint8 newListOffset)
 		return;
 	}
 
+	// Staff joining or leaving the peep list changes the list of mechanics
+	if ((oldList == SPRITE_LIST_PEEP || newList == SPRITE_LIST_PEEP) && sprite->peep.type == PEEP_TYPE_STAFF) {
+		staff_invalidate_mechanic_list();
+	}
+
 	// If the sprite is currently the head of the list, the
 	// sprite following this one becomes the new head of the list.
 	if (unkSprite->previous == SPRITE_INDEX_NULL) {
@@ -449,12 +590,21 @@ void sprite_move(sint16 x, sint16 y, sint16 z, rct_sprite* sprite){
 	}
 
 	if (x == SPRITE_LOCATION_NULL){
+		sprite_invalidate_interaction_cache(sprite);
 		sprite->unknown.sprite_left = SPRITE_LOCATION_NULL;
 		sprite->unknown.x = x;
 		sprite->unknown.y = y;
 		sprite->unknown.z = z;
 		return;
 	}
+	sprite_set_coordinates(x, y, z, sprite);
+}
+
+/**
+ * Sets the coordinates and screen bounds of a sprite without moving it to its new quadrant.
+ */
+void sprite_set_coordinates(sint16 x, sint16 y, sint16 z, rct_sprite *sprite)
+{
 	sint16 new_x = x, new_y = y, start_x = x;
 	switch (get_current_rotation()){
 	case 0:
@@ -475,6 +625,7 @@ void sprite_move(sint16 x, sint16 y, sint16 z, rct_sprite* sprite){
 		break;
 	}
 
+	sprite_invalidate_interaction_cache(sprite);
 	sprite->unknown.sprite_left = new_x - sprite->unknown.sprite_width;
 	sprite->unknown.sprite_right = new_x + sprite->unknown.sprite_width;
 	sprite->unknown.sprite_top = new_y - sprite->unknown.sprite_height_negative;
@@ -482,6 +633,7 @@ void sprite_move(sint16 x, sint16 y, sint16 z, rct_sprite* sprite){
 	sprite->unknown.x = x;
 	sprite->unknown.y = y;
 	sprite->unknown.z = z;
+	sprite_invalidate_interaction_cache(sprite);
 }
 
 /**
@@ -490,6 +642,10 @@ void sprite_move(sint16 x, sint16 y, sint16 z, rct_sprite* sprite){
  */
 void sprite_remove(rct_sprite *sprite)
 {
+	sprite_invalidate_interaction_cache(sprite);
+	if (sprite->unknown.linked_list_type_offset == SPRITE_LIST_LITTER * 2) {
+		park_litter_removed(sprite->litter.creationTick);
+	}
 	move_sprite_to_list(sprite, SPRITE_LIST_NULL * 2);
 	user_string_free(sprite->unknown.name_string_idx);
 	sprite->unknown.sprite_identifier = SPRITE_IDENTIFIER_NULL;
@@ -584,6 +740,7 @@ void litter_create(int x, int y, int z, int direction, int type)
 	sprite_move(x, y, z, (rct_sprite*)litter);
 	invalidate_sprite_0((rct_sprite*)litter);
 	litter->creationTick = gScenarioTicks;
+	park_litter_created(litter->creationTick);
 }
 
 /**
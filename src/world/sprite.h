@@ -374,6 +374,16 @@ extern rct_sprite_entry* g_sprite_entries;
 extern uint16 *gSpriteListHead;
 extern uint16 *gSpriteListCount;
 
+typedef struct sprite_invalidation_stats {
+	uint32 queued;			// Sprite rectangles invalidated
+	uint32 flushed;			// Rectangles left after merging
+	uint32 blocks_before;	// Dirty blocks the invalidated rectangles would mark on their own
+	uint32 blocks_after;	// Dirty blocks marked by the merged rectangles
+} sprite_invalidation_stats;
+
+extern bool gSpriteInvalidationStatsEnabled;
+extern sprite_invalidation_stats gSpriteInvalidationStats;
+
 rct_sprite *create_sprite(uint8 bl);
 void reset_sprite_list();
 void reset_0x69EBE4();
@@ -381,9 +391,12 @@ void sprite_clear_all_unused();
 void move_sprite_to_list(rct_sprite *sprite, uint8 cl);
 void sprite_misc_update_all();
 void sprite_move(sint16 x, sint16 y, sint16 z, rct_sprite* sprite);
+void sprite_set_coordinates(sint16 x, sint16 y, sint16 z, rct_sprite *sprite);
 void invalidate_sprite_0(rct_sprite* sprite);
 void invalidate_sprite_1(rct_sprite *sprite);
 void invalidate_sprite_2(rct_sprite *sprite);
+void sprite_flush_invalidations();
+void sprite_invalidation_stats_end_frame();
 void sprite_remove(rct_sprite *sprite);
 void litter_create(int x, int y, int z, int direction, int type);
 void litter_remove_at(int x, int y, int z);